@@ -0,0 +1,142 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ns_free_func
+{
+
+template<int N>
+static int free_func(int value) { return value + N; }
+
+template<int N>
+static int free_func(int value, double factor) { return static_cast<int>(value * factor) + N; }
+
+template<int... I>
+static void register_free_functions(std::integer_sequence<int, I...>)
+{
+    using namespace rttr;
+    using expander = int[];
+    (void)expander{0, (registration::method("free_func_" + std::to_string(I), select_overload<int(int)>(&free_func<I>)), 0)...};
+    (void)expander{0, (registration::method("free_func_" + std::to_string(I), select_overload<int(int, double)>(&free_func<I>)), 0)...};
+}
+
+} // end namespace ns_free_func
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    // simulate a scripting front end, which exposes a few hundred overloaded free functions
+    ns_free_func::register_free_functions(std::make_integer_sequence<int, 200>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("bench_invoke_global_function_arg_1") {
+
+    BENCHMARK_ADVANCED("native")(Catch::Benchmark::Chronometer meter) {
+        volatile int value = 23;
+        meter.measure([&] {
+            return ns_free_func::free_func<42>(value);
+        });
+    };
+
+    BENCHMARK_ADVANCED("rttr - string_view")(Catch::Benchmark::Chronometer meter) {
+        meter.measure([&] {
+            return rttr::type::invoke("free_func_42", {23});
+        });
+    };
+
+    BENCHMARK_ADVANCED("rttr - name_id")(Catch::Benchmark::Chronometer meter) {
+        const rttr::name_id func_id("free_func_42");
+        meter.measure([&] {
+            return rttr::type::invoke(func_id, {23});
+        });
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("bench_invoke_global_function_arg_2") {
+
+    BENCHMARK_ADVANCED("native")(Catch::Benchmark::Chronometer meter) {
+        volatile int value = 23;
+        meter.measure([&] {
+            return ns_free_func::free_func<42>(value, 2.0);
+        });
+    };
+
+    BENCHMARK_ADVANCED("rttr - string_view")(Catch::Benchmark::Chronometer meter) {
+        meter.measure([&] {
+            return rttr::type::invoke("free_func_42", {23, 2.0});
+        });
+    };
+
+    BENCHMARK_ADVANCED("rttr - name_id")(Catch::Benchmark::Chronometer meter) {
+        const rttr::name_id func_id("free_func_42");
+        meter.measure([&] {
+            return rttr::type::invoke(func_id, {23, 2.0});
+        });
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("bench_find_global_function") {
+
+    BENCHMARK_ADVANCED("rttr - string_view")(Catch::Benchmark::Chronometer meter) {
+        const std::vector<rttr::type> params = {rttr::type::get<int>(), rttr::type::get<double>()};
+        meter.measure([&] {
+            return rttr::type::get_global_method("free_func_199", params);
+        });
+    };
+
+    BENCHMARK_ADVANCED("rttr - name_id")(Catch::Benchmark::Chronometer meter) {
+        const rttr::name_id func_id("free_func_199");
+        const std::vector<rttr::type> params = {rttr::type::get<int>(), rttr::type::get<double>()};
+        meter.measure([&] {
+            return rttr::type::get_global_method(func_id, params);
+        });
+    };
+}
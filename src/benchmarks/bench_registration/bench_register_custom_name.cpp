@@ -0,0 +1,94 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <rttr/registration>
+
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// Every 'registration::class_<T>("name")' assigns a custom name, which has to be propagated
+// to all types embedding the name of 'T' (pointer, array and template instance types).
+// Here we register a bigger amount of types first and measure the registration of named classes afterwards.
+
+// the instantiation of a type is expensive at compile time, therefore we keep this number moderate
+static const std::size_t g_background_class_count   = 500;
+static const std::size_t g_named_class_count        = 50;
+
+template<std::size_t I>
+struct bench_background_class { };
+
+template<std::size_t I>
+struct bench_named_class { };
+
+template<std::size_t... I>
+static std::size_t register_background_classes(std::index_sequence<I...>)
+{
+    // every class together with its pointer type
+    std::vector<rttr::type> types = { rttr::type::get<bench_background_class<I>>()..., rttr::type::get<bench_background_class<I>*>()... };
+    return types.size();
+}
+
+template<std::size_t... I>
+static void register_named_classes(const std::vector<std::string>& names, std::index_sequence<I...>)
+{
+    (rttr::registration::class_<bench_named_class<I>>(names[I]), ...);
+}
+
+static std::vector<std::string> create_names(const std::string& prefix)
+{
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < g_named_class_count; ++i)
+        names.push_back(prefix + std::to_string(i));
+    return names;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("bench_register_custom_name") {
+
+    const auto type_count = register_background_classes(std::make_index_sequence<g_background_class_count>());
+    REQUIRE(rttr::type::get_types().size() >= type_count);
+
+    const auto names_a = create_names("bench_class_a_");
+    const auto names_b = create_names("bench_class_b_");
+
+    // the names alternate, so that every registration has to rename the types
+    BENCHMARK_ADVANCED("register 50 named classes")(Catch::Benchmark::Chronometer meter) {
+        meter.measure([&](int i)
+        {
+            register_named_classes((i % 2 == 0) ? names_a : names_b, std::make_index_sequence<g_named_class_count>());
+            return i;
+        });
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
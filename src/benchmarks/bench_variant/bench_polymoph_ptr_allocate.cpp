@@ -0,0 +1,176 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <rttr/registration>
+
+#include <catch2/catch_all.hpp>
+
+#include <memory_resource>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct bench_scene_node
+{
+    bench_scene_node(int value) : m_value(value) {}
+    virtual ~bench_scene_node() {}
+    virtual int get_value() const { return m_value; }
+
+    int m_value;
+
+    RTTR_ENABLE()
+};
+
+struct bench_mesh_node : bench_scene_node
+{
+    bench_mesh_node(int value) : bench_scene_node(value) {}
+    int get_value() const override { return m_value + m_vertex_count; }
+
+    int m_vertex_count = 3;
+
+    RTTR_ENABLE(bench_scene_node)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    rttr::registration::class_<bench_scene_node>("bench_scene_node");
+
+    rttr::registration::class_<bench_mesh_node>("bench_mesh_node")
+        .constructor<int>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const int g_node_count = 10000;
+
+using node_ptr = rttr::polymoph_ptr<bench_scene_node>;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("bench_polymoph_ptr_create") {
+
+    BENCHMARK_ADVANCED("shared_ptr - raw ptr")(Catch::Benchmark::Chronometer meter) {
+        std::vector<node_ptr> nodes;
+        nodes.reserve(g_node_count);
+        meter.measure([&]
+        {
+            nodes.clear();
+            for (int i = 0; i < g_node_count; ++i)
+                nodes.emplace_back(new bench_mesh_node(i));
+            return nodes.size();
+        });
+    };
+
+    BENCHMARK_ADVANCED("shared_ptr - by name")(Catch::Benchmark::Chronometer meter) {
+        std::vector<node_ptr> nodes;
+        nodes.reserve(g_node_count);
+        meter.measure([&]
+        {
+            nodes.clear();
+            for (int i = 0; i < g_node_count; ++i)
+                nodes.push_back(node_ptr::make("bench_mesh_node", {i}));
+            return nodes.size();
+        });
+    };
+
+    BENCHMARK_ADVANCED("arena - allocate<U>")(Catch::Benchmark::Chronometer meter) {
+        std::vector<node_ptr> nodes;
+        nodes.reserve(g_node_count);
+        meter.measure([&]
+        {
+            nodes.clear();
+            std::pmr::monotonic_buffer_resource arena;
+            std::pmr::polymorphic_allocator<bench_mesh_node> alloc(&arena);
+            for (int i = 0; i < g_node_count; ++i)
+                nodes.push_back(node_ptr::allocate<bench_mesh_node>(alloc, i));
+            const auto size = nodes.size();
+            nodes.clear();
+            return size;
+        });
+    };
+
+    BENCHMARK_ADVANCED("arena - factory")(Catch::Benchmark::Chronometer meter) {
+        const auto mesh_factory = rttr::type::get_by_name("bench_mesh_node").get_factory({rttr::type::get<int>()});
+        std::vector<node_ptr> nodes;
+        nodes.reserve(g_node_count);
+        meter.measure([&]
+        {
+            nodes.clear();
+            std::pmr::monotonic_buffer_resource arena;
+            for (int i = 0; i < g_node_count; ++i)
+                nodes.push_back(node_ptr::make(&arena, mesh_factory, {i}));
+            const auto size = nodes.size();
+            nodes.clear();
+            return size;
+        });
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static int sum_nodes(const std::vector<node_ptr>& nodes)
+{
+    int result = 0;
+    for (const auto& node : nodes)
+        result += node->get_value();
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("bench_polymoph_ptr_traverse") {
+
+    // other allocations interleave with the nodes in a real scene graph
+    std::vector<std::unique_ptr<char[]>> other_data;
+
+    BENCHMARK_ADVANCED("shared_ptr - raw ptr")(Catch::Benchmark::Chronometer meter) {
+        std::vector<node_ptr> nodes;
+        for (int i = 0; i < g_node_count; ++i)
+        {
+            nodes.emplace_back(new bench_mesh_node(i));
+            other_data.emplace_back(new char[64]);
+        }
+        meter.measure([&] { return sum_nodes(nodes); });
+    };
+
+    BENCHMARK_ADVANCED("arena - allocate<U>")(Catch::Benchmark::Chronometer meter) {
+        std::pmr::monotonic_buffer_resource arena;
+        std::pmr::polymorphic_allocator<bench_mesh_node> alloc(&arena);
+        std::vector<node_ptr> nodes;
+        for (int i = 0; i < g_node_count; ++i)
+        {
+            nodes.push_back(node_ptr::allocate<bench_mesh_node>(alloc, i));
+            other_data.emplace_back(new char[64]);
+        }
+        meter.measure([&] { return sum_nodes(nodes); });
+    };
+}
+
+/////
@@ -0,0 +1,130 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/type>
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace rttr;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// Comparing variants of different arithmetic types uses the compare kernel table
+// in 'variant_compare.cpp', variants of the same type are compared directly.
+
+static const std::size_t g_value_count = 100000;
+
+static std::vector<variant> create_mixed_values(std::size_t count)
+{
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> dist(-1000, 1000);
+
+    std::vector<variant> values;
+    values.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const int value = dist(engine);
+        switch (i % 6)
+        {
+            case 0: values.emplace_back(value); break;
+            case 1: values.emplace_back(static_cast<double>(value) + 0.5); break;
+            case 2: values.emplace_back(static_cast<float>(value)); break;
+            case 3: values.emplace_back(static_cast<int64_t>(value)); break;
+            case 4: values.emplace_back(static_cast<int16_t>(value)); break;
+            case 5: values.emplace_back(static_cast<uint32_t>(value < 0 ? -value : value)); break;
+        }
+    }
+
+    return values;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("bench_variant_compare - sort") {
+
+    const auto values = create_mixed_values(g_value_count);
+
+    BENCHMARK_ADVANCED("sort mixed arithmetic values")(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<variant>> data(meter.runs(), values);
+        meter.measure([&](int i)
+        {
+            std::sort(data[i].begin(), data[i].end());
+            return data[i].size();
+        });
+    };
+
+    BENCHMARK_ADVANCED("sort mixed arithmetic values - to_double")(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<variant>> data(meter.runs(), values);
+        meter.measure([&](int i)
+        {
+            std::sort(data[i].begin(), data[i].end(), [](const variant& lhs, const variant& rhs)
+            {
+                return (lhs.to_double() < rhs.to_double());
+            });
+            return data[i].size();
+        });
+    };
+
+    std::vector<variant> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    CHECK(std::is_sorted(sorted.begin(), sorted.end(), [](const variant& lhs, const variant& rhs)
+    {
+        return (lhs.to_double() < rhs.to_double());
+    }));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("bench_variant_compare - equal") {
+
+    const auto values = create_mixed_values(g_value_count);
+    const variant probe_int     = 42;
+    const variant probe_double  = 42.5;
+
+    BENCHMARK("count equal mixed values - int") {
+        return std::count(values.begin(), values.end(), probe_int);
+    };
+
+    BENCHMARK("count equal mixed values - double") {
+        return std::count(values.begin(), values.end(), probe_double);
+    };
+
+    BENCHMARK("count equal mixed values - to_double") {
+        const double probe = probe_int.to_double();
+        return std::count_if(values.begin(), values.end(), [probe](const variant& value)
+        {
+            return (value.to_double() == probe);
+        });
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -179,6 +179,70 @@ variant constructor::invoke_variadic(std::vector<argument> args) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool constructor::invoke_at(void* storage) const
+{
+    return m_wrapper->invoke_at(storage, nullptr, 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool constructor::invoke_at(void* storage, argument arg1) const
+{
+    const argument args[] = {arg1};
+    return m_wrapper->invoke_at(storage, args, 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool constructor::invoke_at(void* storage, argument arg1, argument arg2) const
+{
+    const argument args[] = {arg1, arg2};
+    return m_wrapper->invoke_at(storage, args, 2);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool constructor::invoke_at(void* storage, argument arg1, argument arg2, argument arg3) const
+{
+    const argument args[] = {arg1, arg2, arg3};
+    return m_wrapper->invoke_at(storage, args, 3);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool constructor::invoke_at(void* storage, argument arg1, argument arg2, argument arg3, argument arg4) const
+{
+    const argument args[] = {arg1, arg2, arg3, arg4};
+    return m_wrapper->invoke_at(storage, args, 4);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool constructor::invoke_at(void* storage, argument arg1, argument arg2, argument arg3, argument arg4,
+                            argument arg5) const
+{
+    const argument args[] = {arg1, arg2, arg3, arg4, arg5};
+    return m_wrapper->invoke_at(storage, args, 5);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool constructor::invoke_at(void* storage, argument arg1, argument arg2, argument arg3, argument arg4,
+                            argument arg5, argument arg6) const
+{
+    const argument args[] = {arg1, arg2, arg3, arg4, arg5, arg6};
+    return m_wrapper->invoke_at(storage, args, 6);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool constructor::invoke_at_variadic(void* storage, std::vector<argument> args) const
+{
+    return m_wrapper->invoke_at(storage, args.data(), args.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool constructor::operator==(const constructor& other) const RTTR_NOEXCEPT
 {
     return (m_wrapper == other.m_wrapper);
@@ -269,6 +269,66 @@ class RTTR_API constructor
          */
         variant invoke_variadic(std::vector<argument> args) const;
 
+        /*!
+         * \brief Constructs an object of the declaring type in place, inside the given \p storage.
+         *        No memory will be allocated and no \ref variant object will be created.
+         *
+         * The \p storage has to be at least \ref type::get_sizeof() bytes large and aligned to
+         * \ref type::get_alignof() of the declaring type. The object has to be destroyed afterwards
+         * with \ref destructor::invoke_at().
+         *
+         * \remark Only constructors registered with \ref registration::class_<T>::constructor() "constructor<Args...>()"
+         *         can construct in place; for custom creator functions and for omitted \ref default_arguments,
+         *         false is returned. The given argument types have to match **exactly** the parameter types.
+         *
+         * \see get_declaring_type(), type::get_sizeof(), type::get_alignof()
+         *
+         * \return True when the object was constructed, otherwise false.
+         */
+        bool invoke_at(void* storage) const;
+
+        /*!
+         * \copydoc invoke_at(void*) const
+         */
+        bool invoke_at(void* storage, argument arg1) const;
+
+        /*!
+         * \copydoc invoke_at(void*) const
+         */
+        bool invoke_at(void* storage, argument arg1, argument arg2) const;
+
+        /*!
+         * \copydoc invoke_at(void*) const
+         */
+        bool invoke_at(void* storage, argument arg1, argument arg2, argument arg3) const;
+
+        /*!
+         * \copydoc invoke_at(void*) const
+         */
+        bool invoke_at(void* storage, argument arg1, argument arg2, argument arg3, argument arg4) const;
+
+        /*!
+         * \copydoc invoke_at(void*) const
+         */
+        bool invoke_at(void* storage, argument arg1, argument arg2, argument arg3, argument arg4,
+                       argument arg5) const;
+
+        /*!
+         * \copydoc invoke_at(void*) const
+         */
+        bool invoke_at(void* storage, argument arg1, argument arg2, argument arg3, argument arg4,
+                       argument arg5, argument arg6) const;
+
+        /*!
+         * \brief Constructs an object of the declaring type in place, inside the given \p storage.
+         *         Use this method when you need to instantiate a constructor with more then 6 parameters.
+         *
+         * \see invoke_at(void*) const
+         *
+         * \return True when the object was constructed, otherwise false.
+         */
+        bool invoke_at_variadic(void* storage, std::vector<argument> args) const;
+
         /*!
          * \brief Returns true if this constructor is the same like the \p other.
          *
@@ -292,6 +352,7 @@ class RTTR_API constructor
         template<typename T>
         friend T detail::create_invalid_item();
         friend class visitor;
+        friend class type;
 
     private:
         const detail::constructor_wrapper_base* m_wrapper;
@@ -96,6 +96,13 @@ bool destructor::invoke(variant& obj) const RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool destructor::invoke_at(void* storage) const RTTR_NOEXCEPT
+{
+    return m_wrapper->invoke_at(storage);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool destructor::operator==(const destructor& other) const RTTR_NOEXCEPT
 {
     return (m_wrapper == other.m_wrapper);
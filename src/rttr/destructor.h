@@ -112,6 +112,19 @@ class RTTR_API destructor
          */
         bool invoke(variant& obj) const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Destroys the object, which was constructed in place inside the given \p storage.
+         *
+         * Only the destructor of the object is called, the memory of \p storage is not released.
+         * This is the counterpart of \ref constructor::invoke_at().
+         *
+         * \remark The \p storage has to contain an object of the declaring type,
+         *         otherwise the behavior is undefined.
+         *
+         * \return True if the destructor of the object could be invoked, otherwise false.
+         */
+        bool invoke_at(void* storage) const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns true if this destructor is the same like the \p other.
          *
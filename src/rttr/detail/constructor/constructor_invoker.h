@@ -32,6 +32,8 @@
 #include "rttr/detail/misc/utility.h"
 #include "rttr/detail/policies/ctor_policies.h"
 
+#include <new>
+
 namespace rttr
 {
 namespace detail
@@ -78,6 +80,20 @@ struct constructor_invoker<ctor_type, as_object, type_list<Class_Type, Ctor_Args
         else
             return variant();
     }
+
+    template<typename... TArgs>
+    static RTTR_INLINE bool create_at(void* storage, TArgs&&...args)
+    {
+        if (check_all_true(args. template is_type<Ctor_Args>()...))
+        {
+            ::new (storage) Class_Type(args. template get_value<Ctor_Args>()...);
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -88,11 +104,21 @@ struct constructor_invoker<ctor_type, as_std_shared_ptr, type_list<Class_Type, C
     using return_type = std::shared_ptr<Class_Type>;
 
     template<typename... TArgs>
-    static RTTR_INLINE variant invoke(TArgs&&...args)
+    static RTTR_INLINE return_type create(TArgs&&...args)
     {
         // we cannot use std::make_shared<T> here because, otherwise we cannot instantiate, constructors which are declared as protected or private
         if (check_all_true(args. template is_type<Ctor_Args>()...))
-            return variant(std::shared_ptr<Class_Type>(new Class_Type(args. template get_value<Ctor_Args>()...)));
+            return return_type(new Class_Type(args. template get_value<Ctor_Args>()...));
+        else
+            return return_type();
+    }
+
+    template<typename... TArgs>
+    static RTTR_INLINE variant invoke(TArgs&&...args)
+    {
+        auto obj = create(std::forward<TArgs>(args)...);
+        if (obj)
+            return variant(std::move(obj));
         else
             return variant();
     }
@@ -77,6 +77,8 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
 :   public constructor_wrapper_base, public metadata_handler<Metadata_Count>
 {
     using invoker_class = constructor_invoker<ctor_type, Policy, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
+    using shared_invoker_class = constructor_invoker<ctor_type, as_std_shared_ptr, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
+    using placement_invoker_class = constructor_invoker<ctor_type, as_object, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
     using instanciated_type = typename invoker_class::return_type;
 
     public:
@@ -167,6 +169,34 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
             return invoke_variadic_impl(arg_list, make_index_sequence<sizeof...(Ctor_Args)>());
         }
 
+        template<std::size_t ...I>
+        static RTTR_INLINE std::shared_ptr<void> invoke_shared_impl(const std::vector<argument>& arg_list, index_sequence<I...>)
+        {
+            if (arg_list.size() == sizeof...(I))
+                return shared_invoker_class::create(arg_list[I]...);
+            else
+                return std::shared_ptr<void>();
+        }
+
+        std::shared_ptr<void> invoke_shared(std::vector<argument>& arg_list) const
+        {
+            return invoke_shared_impl(arg_list, make_index_sequence<sizeof...(Ctor_Args)>());
+        }
+
+        template<std::size_t ...I>
+        static RTTR_INLINE bool invoke_at_impl(void* storage, const argument* arg_list, std::size_t arg_count, index_sequence<I...>)
+        {
+            if (arg_count == sizeof...(I) && is_aligned(storage, alignof(Class_Type)))
+                return placement_invoker_class::create_at(storage, arg_list[I]...);
+            else
+                return false;
+        }
+
+        bool invoke_at(void* storage, const argument* arg_list, std::size_t arg_count) const
+        {
+            return invoke_at_impl(storage, arg_list, arg_count, make_index_sequence<sizeof...(Ctor_Args)>());
+        }
+
         void visit(visitor& visitor, const constructor& ctor) const RTTR_NOEXCEPT
         {
             auto obj = make_ctor_info<Class_Type, Policy, Ctor_Args...>(ctor);
@@ -269,6 +299,8 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
 :   public constructor_wrapper_base, public metadata_handler<Metadata_Count>
 {
     using invoker_class = constructor_invoker<ctor_type, Policy, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
+    using shared_invoker_class = constructor_invoker<ctor_type, as_std_shared_ptr, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
+    using placement_invoker_class = constructor_invoker<ctor_type, as_object, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
     using instanciated_type = typename invoker_class::return_type;
 
     public:
@@ -356,6 +388,34 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
             return invoke_variadic_impl(arg_list, make_index_sequence<sizeof...(Ctor_Args)>());
         }
 
+        template<std::size_t ...I>
+        static RTTR_INLINE std::shared_ptr<void> invoke_shared_impl(const std::vector<argument>& arg_list, index_sequence<I...>)
+        {
+            if (arg_list.size() == sizeof...(I))
+                return shared_invoker_class::create(arg_list[I]...);
+            else
+                return std::shared_ptr<void>();
+        }
+
+        std::shared_ptr<void> invoke_shared(std::vector<argument>& arg_list) const
+        {
+            return invoke_shared_impl(arg_list, make_index_sequence<sizeof...(Ctor_Args)>());
+        }
+
+        template<std::size_t ...I>
+        static RTTR_INLINE bool invoke_at_impl(void* storage, const argument* arg_list, std::size_t arg_count, index_sequence<I...>)
+        {
+            if (arg_count == sizeof...(I) && is_aligned(storage, alignof(Class_Type)))
+                return placement_invoker_class::create_at(storage, arg_list[I]...);
+            else
+                return false;
+        }
+
+        bool invoke_at(void* storage, const argument* arg_list, std::size_t arg_count) const
+        {
+            return invoke_at_impl(storage, arg_list, arg_count, make_index_sequence<sizeof...(Ctor_Args)>());
+        }
+
         void visit(visitor& visitor, const constructor& ctor) const RTTR_NOEXCEPT
         {
             auto obj = make_ctor_info<Class_Type, Policy, Ctor_Args...>(ctor);
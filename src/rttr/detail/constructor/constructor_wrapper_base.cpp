@@ -56,7 +56,7 @@ void constructor_wrapper_base::init() RTTR_NOEXCEPT
 {
     create_signature_string();
     get_instantiated_type();
-    get_parameter_infos();
+    m_param_signature = parameter_signature::create(get_parameter_infos());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -147,6 +147,13 @@ array_range<parameter_info> constructor_wrapper_base::get_parameter_infos() cons
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+const parameter_signature& constructor_wrapper_base::get_parameter_signature() const RTTR_NOEXCEPT
+{
+    return m_param_signature;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant constructor_wrapper_base::get_metadata(const variant& /*key*/) const
 {
     return variant();
@@ -212,6 +219,20 @@ variant constructor_wrapper_base::invoke_variadic(std::vector<argument>& /*args*
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+std::shared_ptr<void> constructor_wrapper_base::invoke_shared(std::vector<argument>& /*args*/) const
+{
+    return std::shared_ptr<void>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool constructor_wrapper_base::invoke_at(void* /*storage*/, const argument* /*args*/, std::size_t /*arg_count*/) const
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void constructor_wrapper_base::visit(visitor& /*visitor*/, const constructor& /*ctor*/) const RTTR_NOEXCEPT
 {
 }
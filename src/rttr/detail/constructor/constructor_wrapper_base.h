@@ -30,11 +30,13 @@
 
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/metadata/metadata_handler.h"
+#include "rttr/detail/parameter_info/parameter_signature.h"
 #include "rttr/parameter_info.h"
 #include "rttr/access_levels.h"
 #include "rttr/array_range.h"
 #include "rttr/string_view.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -68,6 +70,7 @@ class RTTR_API constructor_wrapper_base
         virtual std::vector<bool> get_is_reference() const RTTR_NOEXCEPT;
         virtual std::vector<bool> get_is_const() const RTTR_NOEXCEPT;
         virtual array_range<parameter_info> get_parameter_infos() const RTTR_NOEXCEPT;
+        const parameter_signature& get_parameter_signature() const RTTR_NOEXCEPT;
         virtual variant get_metadata(const variant& key) const;
 
         virtual variant invoke() const;
@@ -82,6 +85,18 @@ class RTTR_API constructor_wrapper_base
 
         virtual variant invoke_variadic(std::vector<argument>& args) const;
 
+        /*!
+         * Creates a new object of the declaring type, owned by a std::shared_ptr.
+         * Returns an empty pointer, when the arguments does not match or the constructor is a custom creator function.
+         */
+        virtual std::shared_ptr<void> invoke_shared(std::vector<argument>& args) const;
+
+        /*!
+         * Constructs an object of the declaring type in place, inside \p storage.
+         * Returns false, when the storage is not aligned, the arguments does not match or the constructor is a custom creator function.
+         */
+        virtual bool invoke_at(void* storage, const argument* args, std::size_t arg_count) const;
+
         virtual void visit(visitor& visitor, const constructor& ctor) const RTTR_NOEXCEPT;
     protected:
         void init() RTTR_NOEXCEPT;
@@ -90,6 +105,7 @@ class RTTR_API constructor_wrapper_base
     private:
         string_view m_signature_view;
         std::string m_signature;
+        parameter_signature m_param_signature;
 };
 
 } // end namespace detail
@@ -63,6 +63,20 @@ class destructor_wrapper : public destructor_wrapper_base
                 return false;
             }
         }
+
+        bool invoke_at(void* storage) const RTTR_NOEXCEPT
+        {
+            if (storage)
+            {
+                // the memory itself is owned by the caller, we only end the lifetime of the object
+                static_cast<ClassType*>(storage)->~ClassType();
+                return true;
+            }
+            else
+            {
+                return false;
+            }
+        }
 };
 
 } // end namespace detail
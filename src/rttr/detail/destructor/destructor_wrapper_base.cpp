@@ -74,5 +74,12 @@ bool destructor_wrapper_base::invoke(variant& /*obj*/) const RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool destructor_wrapper_base::invoke_at(void* /*storage*/) const RTTR_NOEXCEPT
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace detail
 } // end namespace rttr
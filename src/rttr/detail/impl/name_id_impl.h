@@ -0,0 +1,151 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_NAME_ID_IMPL_H_
+#define RTTR_NAME_ID_IMPL_H_
+
+#include "rttr/detail/misc/utility.h"
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE name_id::name_id() RTTR_NOEXCEPT
+:   m_data(nullptr),
+    m_size(0),
+    m_hash(detail::generate_hash(nullptr, 0))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE string_view name_id::get_name() const RTTR_NOEXCEPT
+{
+    return (m_data ? string_view(m_data, m_size) : string_view());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE std::size_t name_id::get_hash() const RTTR_NOEXCEPT
+{
+    return m_hash;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool name_id::is_valid() const RTTR_NOEXCEPT
+{
+    return (m_data != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE name_id::operator bool() const RTTR_NOEXCEPT
+{
+    return (m_data != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool name_id::operator==(const name_id& other) const RTTR_NOEXCEPT
+{
+    return (m_data == other.m_data);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool name_id::operator!=(const name_id& other) const RTTR_NOEXCEPT
+{
+    return (m_data != other.m_data);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool operator==(const name_id& lhs, string_view rhs) RTTR_NOEXCEPT
+{
+    return (lhs.get_name() == rhs);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool operator==(string_view lhs, const name_id& rhs) RTTR_NOEXCEPT
+{
+    return (lhs == rhs.get_name());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool operator!=(const name_id& lhs, string_view rhs) RTTR_NOEXCEPT
+{
+    return (lhs.get_name() != rhs);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool operator!=(string_view lhs, const name_id& rhs) RTTR_NOEXCEPT
+{
+    return (lhs != rhs.get_name());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+template <>
+struct hash<name_id>
+{
+public:
+    size_t operator()(const name_id& id) const
+    {
+        return id.get_hash();
+    }
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace std
+{
+    template <>
+    struct hash<rttr::name_id>
+    {
+    public:
+        size_t operator()(const rttr::name_id& id) const
+        {
+            return id.get_hash();
+        }
+    };
+} // end namespace std
+
+#endif // RTTR_NAME_ID_IMPL_H_
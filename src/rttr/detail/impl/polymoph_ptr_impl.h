@@ -2,6 +2,7 @@
 #define RTTR_POLYMOPH_PTR_IMPL_H_
 
 #include "rttr/variant.h"
+#include "rttr/factory.h"
 
 #include <memory>
 
@@ -48,6 +49,17 @@ bool polymoph_ptr<T>::create(std::string type_name, std::vector<argument> args)
         return false;
     }
 
+    std::vector<type> arg_types;
+    arg_types.reserve(args.size());
+    for (const auto& arg : args) {
+        arg_types.push_back(arg.get_type());
+    }
+
+    if (create(real_type.get_factory(arg_types), args)) {
+        return true;
+    }
+
+    // default arguments or custom creator functions, go through the variant
     variant var = real_type.create(args);
     if (!var) {
         return false;
@@ -55,6 +67,25 @@ bool polymoph_ptr<T>::create(std::string type_name, std::vector<argument> args)
     return set_variant(var);
 }
 
+template<typename T>
+bool polymoph_ptr<T>::create(const factory& obj_factory, std::vector<argument> args) {
+
+    if (!obj_factory || !obj_factory.get_declaring_type().is_derived_from(type::get<value_type>())) {
+        return false;
+    }
+
+    auto value = obj_factory.template create_shared<value_type>(std::move(args));
+    if (!value) {
+        return false;
+    }
+
+    clear();
+    m_real_type = obj_factory.get_declaring_type();
+    m_real_ptr_type = m_real_type.get_add_ptr_type();
+    m_value = std::move(value);
+    return true;
+}
+
 template<typename T>
 polymoph_ptr<T> polymoph_ptr<T>::make(std::string type_name, std::vector<argument> args) {
 
@@ -65,6 +96,45 @@ polymoph_ptr<T> polymoph_ptr<T>::make(std::string type_name, std::vector<argumen
     return {};
 }
 
+template<typename T>
+polymoph_ptr<T> polymoph_ptr<T>::make(const factory& obj_factory, std::vector<argument> args) {
+
+    polymoph_ptr<T> result;
+    if (result.create(obj_factory, std::move(args))) {
+        return result;
+    }
+    return {};
+}
+
+template<typename T>
+bool polymoph_ptr<T>::create(std::pmr::memory_resource* resource, const factory& obj_factory, std::vector<argument> args) {
+
+    if (!obj_factory || !obj_factory.get_declaring_type().is_derived_from(type::get<value_type>())) {
+        return false;
+    }
+
+    auto value = obj_factory.template allocate_shared<value_type>(resource, std::move(args));
+    if (!value) {
+        return false;
+    }
+
+    clear();
+    m_real_type = obj_factory.get_declaring_type();
+    m_real_ptr_type = m_real_type.get_add_ptr_type();
+    m_value = std::move(value);
+    return true;
+}
+
+template<typename T>
+polymoph_ptr<T> polymoph_ptr<T>::make(std::pmr::memory_resource* resource, const factory& obj_factory, std::vector<argument> args) {
+
+    polymoph_ptr<T> result;
+    if (result.create(resource, obj_factory, std::move(args))) {
+        return result;
+    }
+    return {};
+}
+
 } // end namespace rttr
 
 #endif // RTTR_POLYMOPH_PTR_IMPL_H_
\ No newline at end of file
@@ -66,6 +66,13 @@ void method_wrapper_base::init() RTTR_NOEXCEPT
 /////////////////////////////////////////////////////////////////////////////////////////
 
 string_view method_wrapper_base::get_name() const RTTR_NOEXCEPT
+{
+    return m_name.get_name();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+name_id method_wrapper_base::get_name_id() const RTTR_NOEXCEPT
 {
     return m_name;
 }
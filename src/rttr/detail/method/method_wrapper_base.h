@@ -36,6 +36,7 @@
 #include "rttr/parameter_info.h"
 #include "rttr/access_levels.h"
 #include "rttr/string_view.h"
+#include "rttr/name_id.h"
 
 #include <string>
 #include <vector>
@@ -64,6 +65,7 @@ class RTTR_API method_wrapper_base
         virtual ~method_wrapper_base();
 
         string_view get_name() const RTTR_NOEXCEPT;
+        name_id get_name_id() const RTTR_NOEXCEPT;
         type get_declaring_type() const RTTR_NOEXCEPT;
 
         virtual bool is_valid() const RTTR_NOEXCEPT;
@@ -96,7 +98,7 @@ class RTTR_API method_wrapper_base
         void create_signature_string() RTTR_NOEXCEPT;
 
     private:
-        string_view m_name;
+        name_id     m_name;
         string_view m_signature_view;
         type        m_declaring_type;
         std::string m_signature;
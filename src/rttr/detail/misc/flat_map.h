@@ -206,6 +206,34 @@ class flat_map
         }
 #endif
 
+        /*!
+         * Erases the entry with the given \p key, without constructing a \p Key object.
+         * \p T must be hashable with \p Hash and comparable with \p Key.
+         */
+        template<typename T>
+        bool erase(const T& key)
+        {
+            const auto hash_value = Hash<T>()(key);
+            auto itr = std::lower_bound(m_key_list.begin(), m_key_list.end(),
+                                        hash_value,
+                                        typename key_data_type::order());
+            for (; itr != m_key_list.end(); ++itr)
+            {
+                auto& item = *itr;
+                if (item.m_hash_value != hash_value)
+                    break;
+
+                if (item.m_key == key)
+                {
+                    m_value_list.erase(m_value_list.begin() + std::distance(m_key_list.begin(), itr));
+                    m_key_list.erase(itr);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
         void clear()
         {
             m_key_list.clear();
@@ -130,6 +130,25 @@ class flat_multimap
             }
         }
 
+        template<typename T>
+        const_iterator find(const T& key) const
+        {
+            const auto hash_value = Hash<T>()(key);
+            auto itr = std::lower_bound(m_key_list.begin(), m_key_list.end(),
+                                        hash_value,
+                                        typename key_data_type::order());
+            for (; itr != m_key_list.end(); ++itr)
+            {
+                auto& item = *itr;
+                if (item.m_hash_value != hash_value)
+                    break;
+
+                if (item.m_key == key)
+                    return (m_value_list.cbegin() + std::distance(m_key_list.cbegin(), itr));
+            }
+            return m_value_list.cend();
+        }
+
         iterator find(const Key& key)
         {
             const auto itr = find_key_const(key);
@@ -34,6 +34,7 @@
 #include "rttr/detail/misc/misc_type_traits.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -194,6 +195,15 @@ static RTTR_FORCE_INLINE bool check_all_true() { return true; }
 template<typename... BoolArgs>
 static RTTR_INLINE bool check_all_true(bool arg1, BoolArgs... args) { return arg1 & check_all_true(args...); }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+// returns true, when the storage is not null and aligned to the given alignment
+
+static RTTR_INLINE bool is_aligned(const void* storage, std::size_t alignment) RTTR_NOEXCEPT
+{
+    return (storage != nullptr && reinterpret_cast<std::uintptr_t>(storage) % alignment == 0);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 // copy the content of any arbitrary array, use it like:
@@ -0,0 +1,96 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_PARAMETER_SIGNATURE_H_
+#define RTTR_PARAMETER_SIGNATURE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/argument.h"
+#include "rttr/parameter_info.h"
+#include "rttr/array_range.h"
+
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * A flat copy of the parameter types of a method or constructor.
+ *
+ * It is created once at registration time, in order to match a call signature
+ * without walking the \ref parameter_info objects of every candidate.
+ */
+struct parameter_signature
+{
+    std::vector<type>   m_param_types;
+    std::size_t         m_required_args = 0;
+
+    static RTTR_INLINE parameter_signature create(const array_range<parameter_info>& param_list)
+    {
+        parameter_signature result;
+        result.m_param_types.reserve(param_list.size());
+        for (const auto& param : param_list)
+        {
+            result.m_param_types.emplace_back(param.get_type());
+            if (!param.has_default_value())
+                result.m_required_args = result.m_param_types.size();
+        }
+
+        return result;
+    }
+
+    //! Returns true, when the parameter types are identical with \p type_list.
+    RTTR_INLINE bool matches(const std::vector<type>& type_list) const RTTR_NOEXCEPT
+    {
+        return (m_param_types == type_list);
+    }
+
+    //! Returns true, when \p args can be used to invoke, missing arguments have to be default arguments.
+    RTTR_INLINE bool matches(const std::vector<argument>& args) const RTTR_NOEXCEPT
+    {
+        const auto arg_count = args.size();
+        if (arg_count < m_required_args || arg_count > m_param_types.size())
+            return false;
+
+        for (std::size_t index = 0; index < arg_count; ++index)
+        {
+            if (m_param_types[index] != args[index].get_type())
+                return false;
+        }
+
+        return true;
+    }
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_PARAMETER_SIGNATURE_H_
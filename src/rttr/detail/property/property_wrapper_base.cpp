@@ -63,6 +63,13 @@ bool property_wrapper_base::is_valid() const RTTR_NOEXCEPT
 /////////////////////////////////////////////////////////////////////////////////////////
 
 string_view property_wrapper_base::get_name() const RTTR_NOEXCEPT
+{
+    return m_name.get_name();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+name_id property_wrapper_base::get_name_id() const RTTR_NOEXCEPT
 {
     return m_name;
 }
@@ -34,6 +34,7 @@
 #include "rttr/variant.h"
 #include "rttr/access_levels.h"
 #include "rttr/string_view.h"
+#include "rttr/name_id.h"
 
 namespace rttr
 {
@@ -61,6 +62,7 @@ class RTTR_API property_wrapper_base
         type get_declaring_type() const RTTR_NOEXCEPT;
 
         string_view get_name() const RTTR_NOEXCEPT;
+        name_id get_name_id() const RTTR_NOEXCEPT;
 
         virtual bool is_valid() const RTTR_NOEXCEPT;
 
@@ -86,7 +88,7 @@ class RTTR_API property_wrapper_base
         void init() RTTR_NOEXCEPT;
 
     private:
-        string_view m_name;
+        name_id     m_name;
         type        m_declaring_type;
 };
 
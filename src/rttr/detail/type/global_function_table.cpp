@@ -0,0 +1,121 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/type/global_function_table.h"
+
+#include <algorithm>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool global_function_table::add_method(const method& meth)
+{
+    overload item{meth, parameter_signature::create(meth.get_parameter_infos())};
+
+    const auto name = meth.get_name_id();
+    auto itr = m_overload_sets.find(name);
+    if (itr == m_overload_sets.end())
+    {
+        overload_set new_set;
+        new_set.emplace_back(std::move(item));
+        m_overload_sets.insert(std::move(name), std::move(new_set));
+    }
+    else
+    {
+        auto& overloads = *itr;
+        const auto found = std::find_if(overloads.cbegin(), overloads.cend(),
+                                        [&item](const overload& other) { return other.m_signature.matches(item.m_signature.m_param_types); });
+        if (found != overloads.cend())
+            return false;
+
+        overloads.emplace_back(std::move(item));
+    }
+
+    m_methods.push_back(meth);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool global_function_table::remove_method(const method& meth)
+{
+    const auto name = meth.get_name_id();
+    auto itr = m_overload_sets.find(name);
+    if (itr == m_overload_sets.end())
+        return false;
+
+    auto& overloads = *itr;
+    const auto old_size = overloads.size();
+    overloads.erase(std::remove_if(overloads.begin(), overloads.end(),
+                                   [&meth](const overload& item) { return (item.m_method == meth); }),
+                    overloads.end());
+
+    if (overloads.size() == old_size)
+        return false;
+
+    if (overloads.empty())
+        m_overload_sets.erase(name);
+
+    m_methods.erase(std::remove(m_methods.begin(), m_methods.end(), meth), m_methods.end());
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool global_function_table::add_property(const property& prop)
+{
+    const auto name = prop.get_name_id();
+    if (m_property_map.find(name) != m_property_map.end())
+        return false;
+
+    m_property_map.insert(std::move(name), property(prop));
+    m_properties.push_back(prop);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool global_function_table::remove_property(const property& prop)
+{
+    const auto itr = m_property_map.find(prop.get_name_id());
+    if (itr == m_property_map.end() || *itr != prop)
+        return false;
+
+    m_property_map.erase(prop.get_name_id());
+    m_properties.erase(std::remove(m_properties.begin(), m_properties.end(), prop), m_properties.end());
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,191 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_GLOBAL_FUNCTION_TABLE_H_
+#define RTTR_GLOBAL_FUNCTION_TABLE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/detail/misc/class_item_mapper.h"
+#include "rttr/detail/misc/flat_map.h"
+#include "rttr/detail/parameter_info/parameter_signature.h"
+#include "rttr/argument.h"
+#include "rttr/method.h"
+#include "rttr/property.h"
+#include "rttr/name_id.h"
+#include "rttr/string_view.h"
+
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * The \ref global_function_table stores all global methods and properties.
+ *
+ * Every name maps to exactly one overload set. Each overload caches its parameter types
+ * and the number of required arguments at registration time. A call like `type::invoke(name, args)`
+ * needs therefore one hash lookup and a comparison of plain type ids per overload,
+ * instead of a walk over the parameter infos of every candidate.
+ *
+ * It is not part of the rttr API.
+ */
+class RTTR_LOCAL global_function_table
+{
+    public:
+        /*!
+         * Adds the global method \p meth to the overload set of its name.
+         *
+         * \return False, when an overload with the same signature was already added, otherwise true.
+         */
+        bool add_method(const method& meth);
+
+        /*!
+         * Removes the global method \p meth from the overload set of its name.
+         *
+         * \return True, when the method was found and removed, otherwise false.
+         */
+        bool remove_method(const method& meth);
+
+        /*!
+         * Adds the global property \p prop.
+         *
+         * \return False, when a property with the same name was already added, otherwise true.
+         */
+        bool add_property(const property& prop);
+
+        /*!
+         * Removes the global property \p prop.
+         *
+         * \return True, when the property was found and removed, otherwise false.
+         */
+        bool remove_property(const property& prop);
+
+        template<typename Name>
+        RTTR_INLINE method find_method(const Name& name) const;
+
+        template<typename Name>
+        RTTR_INLINE method find_method(const Name& name, const std::vector<type>& type_list) const;
+
+        template<typename Name>
+        RTTR_INLINE method find_method(const Name& name, const std::vector<argument>& args) const;
+
+        template<typename Name>
+        RTTR_INLINE property find_property(const Name& name) const;
+
+        //! Returns all global methods, in the order of registration.
+        const std::vector<method>& get_methods() const RTTR_NOEXCEPT { return m_methods; }
+
+        //! Returns all global properties, in the order of registration.
+        const std::vector<property>& get_properties() const RTTR_NOEXCEPT { return m_properties; }
+
+    private:
+        struct overload
+        {
+            method              m_method;
+            parameter_signature m_signature;
+        };
+
+        using overload_set = std::vector<overload>;
+
+        template<typename Name, typename Signature>
+        RTTR_INLINE method find_overload(const Name& name, const Signature& signature) const;
+
+    private:
+        flat_map<name_id, overload_set, hash>   m_overload_sets;
+        flat_map<name_id, property, hash>       m_property_map;
+        std::vector<method>                     m_methods;
+        std::vector<property>                   m_properties;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Name>
+RTTR_INLINE method global_function_table::find_method(const Name& name) const
+{
+    const auto itr = m_overload_sets.find(name);
+    if (itr != m_overload_sets.end() && !itr->empty())
+        return itr->front().m_method;
+
+    return create_invalid_item<method>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Name>
+RTTR_INLINE method global_function_table::find_method(const Name& name, const std::vector<type>& type_list) const
+{
+    return find_overload(name, type_list);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Name>
+RTTR_INLINE method global_function_table::find_method(const Name& name, const std::vector<argument>& args) const
+{
+    return find_overload(name, args);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Name, typename Signature>
+RTTR_INLINE method global_function_table::find_overload(const Name& name, const Signature& signature) const
+{
+    const auto itr = m_overload_sets.find(name);
+    if (itr == m_overload_sets.end())
+        return create_invalid_item<method>();
+
+    for (const auto& item : *itr)
+    {
+        if (item.m_signature.matches(signature))
+            return item.m_method;
+    }
+
+    return create_invalid_item<method>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Name>
+RTTR_INLINE property global_function_table::find_property(const Name& name) const
+{
+    const auto itr = m_property_map.find(name);
+    if (itr != m_property_map.end())
+        return *itr;
+
+    return create_invalid_item<property>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_GLOBAL_FUNCTION_TABLE_H_
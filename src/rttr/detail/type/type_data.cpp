@@ -41,7 +41,7 @@ static type_data& get_invalid_type_data_impl() RTTR_NOEXCEPT
                                nullptr, nullptr,
                                nullptr, nullptr,
                                std::string(""), string_view(),
-                               0, 0,
+                               0, 0, 0,
                                &create_invalid_variant_policy::create_variant,
                                &base_classes<void>::get_types,
                                nullptr,
@@ -46,6 +46,7 @@
 
 #include <type_traits>
 #include <bitset>
+#include <atomic>
 
 
 namespace rttr
@@ -79,8 +80,14 @@ struct RTTR_LOCAL class_data
     std::vector<type>           m_base_types;
     std::vector<type>           m_derived_types;
     std::vector<rttr_cast_func> m_conversion_list;
+    // only the items declared by this class, the items of the base classes are stored in their own class_data
+    std::vector<property>       m_own_properties;
+    std::vector<method>         m_own_methods;
+    // flattened view of the base class items followed by the own items, build on first access;
+    // it stays empty, when no base class has any items
     std::vector<property>       m_properties;
     std::vector<method>         m_methods;
+    std::atomic<bool>           m_is_member_view_valid { false };
     std::vector<constructor>    m_ctors;
     std::vector<type>           m_nested_types;
     destructor                  m_dtor;
@@ -141,6 +148,7 @@ struct RTTR_LOCAL type_data
     string_view type_name;
 
     std::size_t get_sizeof;
+    std::size_t get_alignof;
     std::size_t get_pointer_dimension;
 
     impl::create_variant_func create_variant;
@@ -186,6 +194,28 @@ struct RTTR_LOCAL get_size_of<T, enable_if_t<std::is_same<T, void>::value || std
     }
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Enable = void>
+struct RTTR_LOCAL get_align_of
+{
+    RTTR_INLINE RTTR_CONSTEXPR static std::size_t value()
+    {
+        return alignof(T);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+struct RTTR_LOCAL get_align_of<T, enable_if_t<std::is_same<T, void>::value || std::is_function<T>::value>>
+{
+    RTTR_INLINE RTTR_CONSTEXPR static std::size_t value()
+    {
+        return 0;
+    }
+};
+
 /////////////////////////////////////////////////////////////////////////////////
 
 template<typename T, bool = std::is_same<T, typename raw_type<T>::type >::value>
@@ -374,6 +404,7 @@ RTTR_LOCAL std::unique_ptr<type_data> make_type_data()
                             ::rttr::detail::get_type_name<T>().to_string(), ::rttr::detail::get_type_name<T>(),
 
                             get_size_of<T>::value(),
+                            get_align_of<T>::value(),
                             pointer_count<T>::value,
 
                             &create_variant_func<T>::create_variant,
@@ -216,6 +216,13 @@ RTTR_INLINE std::size_t type::get_sizeof() const RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+RTTR_INLINE std::size_t type::get_alignof() const RTTR_NOEXCEPT
+{
+    return m_type_data->get_alignof;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 RTTR_INLINE std::size_t type::get_pointer_dimension() const RTTR_NOEXCEPT
 {
     return m_type_data->get_pointer_dimension;
@@ -316,30 +316,23 @@ void type_register_private::unregister_reg_manager(registration_manager* manager
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-flat_multimap<string_view, ::rttr::method>& type_register_private::get_global_method_storage()
+global_function_table& type_register_private::get_global_function_table()
 {
-    return m_global_method_stroage;
+    return m_global_function_table;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-flat_multimap<string_view, ::rttr::property>& type_register_private::get_global_property_storage()
+const std::vector<method>& type_register_private::get_global_methods()
 {
-    return m_global_property_stroage;
+    return m_global_function_table.get_methods();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::vector<method>& type_register_private::get_global_methods()
+const std::vector<property>& type_register_private::get_global_properties()
 {
-    return m_global_methods;
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////
-
-std::vector<property>& type_register_private::get_global_properties()
-{
-    return m_global_properties;
+    return m_global_function_table.get_properties();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -468,16 +461,6 @@ static std::vector<type> convert_param_list(const array_range<parameter_info>& p
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-template<typename T>
-static array_range<T> get_items_for_type(const type& t,
-                                         const std::vector<T>& vec)
-{
-    return array_range<T>(vec.data(), vec.size(),
-                          detail::default_predicate<T>([t](const T& item) { return (item.get_declaring_type() == t); }) );
-}
-
-/////////////////////////////////////////////////////////////////////////////////////
-
 template<typename T, typename I>
 static bool remove_container_item(T& container, const I& item)
 {
@@ -510,7 +493,7 @@ type_data* type_register_private::register_name_if_neccessary(type_data* info)
 
     m_orig_name_to_id.insert(std::make_pair(info->type_name, type(info)));
     info->name = derive_name(type(info));
-    m_custom_name_to_id.insert(std::make_pair(info->name, type(info)));
+    m_custom_name_to_id.insert(std::make_pair(name_id(info->name), type(info)));
 
     m_type_list.emplace_back(type(info));
     return nullptr;
@@ -578,13 +561,12 @@ type_data* type_register_private::register_type(type_data* info) RTTR_NOEXCEPT
     // has to be done as last step
     register_base_class_info(info);
 
+    register_name_dependencies(type(info));
+
     update_custom_name(derive_template_instance_name(info), type(info));
 
-    // when a base class type has class items, but the derived one not,
-    // we update the derived class item list
-    const auto t = type(info);
-    update_class_list(t, &class_data::m_properties);
-    update_class_list(t, &class_data::m_methods);
+    // the flattened member view contains now also the items of the base classes
+    invalidate_member_view(type(info));
 
     return info;
 }
@@ -641,9 +623,11 @@ void type_register_private::unregister_type(type_data* info) RTTR_NOEXCEPT
         type obj_t(info);
         remove_container_item(m_type_list, obj_t);
         remove_derived_types_from_base_classes(obj_t, info->m_class_data.m_base_types);
+        invalidate_member_view(obj_t);
         remove_base_types_from_derived_classes(obj_t, info->m_class_data.m_derived_types);
+        unregister_name_dependencies(obj_t);
         m_orig_name_to_id.erase(info->type_name);
-        m_custom_name_to_id.erase(info->name);
+        m_custom_name_to_id.erase(string_view(info->name));
     }
 }
 
@@ -693,10 +677,10 @@ void type_register_private::update_custom_name(std::string new_name, const type&
 
     if (new_name != type_name)
     {
-        m_custom_name_to_id.erase(type_name);
+        m_custom_name_to_id.erase(string_view(type_name));
 
         type_name = std::move(new_name);
-        m_custom_name_to_id.insert(std::make_pair(type_name, t));
+        m_custom_name_to_id.insert(std::make_pair(name_id(type_name), t));
     }
 }
 
@@ -728,6 +712,62 @@ std::string type_register_private::derive_name(const type& t)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+std::vector<type> type_register_private::get_name_source_types(const type& t)
+{
+    std::vector<type> result;
+    // same order like in 'derive_name'
+    if (t.is_array() && t.get_raw_array_type().is_valid())
+        result.push_back(t.get_raw_array_type());
+    else if (t != t.get_raw_type())
+        result.push_back(t.get_raw_type());
+
+    for (const auto& item : t.m_type_data->m_class_data.m_nested_types)
+    {
+        if (item != t && std::find(result.begin(), result.end(), item) == result.end())
+            result.push_back(item);
+    }
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::register_name_dependencies(const type& t)
+{
+    const auto source_types = get_name_source_types(t);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& source_type : source_types)
+        m_name_dependent_types[source_type.m_type_data].push_back(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::unregister_name_dependencies(const type& t)
+{
+    // REMARK: the source types might be already unregistered, so we can only compare their addresses
+    m_name_dependent_types.erase(t.m_type_data);
+    for (auto& item : m_name_dependent_types)
+        remove_container_item(item.second, t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool type_register_private::update_derived_name(const type& t)
+{
+    const auto old_name = t.m_type_data->name;
+
+    if (t.get_raw_type() != t || (t.is_array() && t.get_raw_array_type().is_valid()))
+        update_custom_name(derive_name(t), t);
+
+    if (t.is_template_instantiation())
+        update_custom_name(derive_template_instance_name(t.m_type_data), t);
+
+    return (old_name != t.m_type_data->name);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void type_register_private::register_custom_name(type& t, string_view custom_name)
 {
     if (!t.is_valid())
@@ -735,23 +775,28 @@ void type_register_private::register_custom_name(type& t, string_view custom_nam
 
     update_custom_name(custom_name.to_string(), t);
 
-    // we have to make a copy of the list, because we also perform an insertion with 'update_custom_name'
-    auto tmp_type_list = m_custom_name_to_id.value_data();
-    for (auto& tt : tmp_type_list)
+    // only the types which embed the name of 't' have to be derived again,
+    // when their name changes, the types which embeds their name are following
+    std::vector<type> pending_types;
+    auto add_dependent_types = [this, &pending_types](const type& source_type)
     {
-        if (tt == t || tt.get_raw_type() == tt)
-            continue;
-
-        auto new_name = derive_name(tt);
-        update_custom_name(new_name, tt);
-    }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto ret = m_name_dependent_types.find(source_type.m_type_data);
+        if (ret != m_name_dependent_types.end())
+            pending_types.insert(pending_types.end(), ret->second.begin(), ret->second.end());
+    };
 
-    for (auto& tt : tmp_type_list)
+    add_dependent_types(t);
+    while (!pending_types.empty())
     {
-        if (tt == t || !tt.is_template_instantiation())
+        const auto tt = pending_types.back();
+        pending_types.pop_back();
+
+        if (tt == t)
             continue;
 
-        update_custom_name(derive_template_instance_name(tt.m_type_data), tt);
+        if (update_derived_name(tt))
+            add_dependent_types(tt);
     }
 }
 
@@ -790,16 +835,16 @@ bool type_register_private::register_destructor(const destructor_wrapper_base* d
 bool type_register_private::register_property(const property_wrapper_base* prop)
 {
     const auto t    = prop->get_declaring_type();
-    const auto name = prop->get_name();
+    const auto name = prop->get_name_id();
 
-    auto& property_list = t.m_type_data->m_class_data.m_properties;
+    auto& property_list = t.m_type_data->m_class_data.m_own_properties;
 
     if (get_type_property(t, name))
         return false;
 
     auto p = detail::create_item<::rttr::property>(prop);
     property_list.emplace_back(p);
-    update_class_list(t, &class_data::m_properties);
+    invalidate_member_view(t);
     return true;
 }
 
@@ -807,27 +852,14 @@ bool type_register_private::register_property(const property_wrapper_base* prop)
 
 bool type_register_private::register_global_property(const property_wrapper_base* prop)
 {
-    const auto t    = prop->get_declaring_type();
-    const auto name = prop->get_name();
-
-     if (t.get_global_property(name))
-         return false;
-
-     auto p = detail::create_item<::rttr::property>(prop);
-     get_global_properties().emplace_back(p);
-     get_global_property_storage().insert(std::move(name), std::move(p));
-     return true;
+    return m_global_function_table.add_property(detail::create_item<::rttr::property>(prop));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool type_register_private::unregister_global_property(const property_wrapper_base* prop)
 {
-    auto& g_props   = get_global_property_storage();
-    auto result     = g_props.erase(prop->get_name());
-
-    auto result2 = remove_container_item(get_global_properties(), create_item<rttr::property>(prop));
-    return result && result2;
+    return m_global_function_table.remove_property(create_item<rttr::property>(prop));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -837,15 +869,15 @@ bool type_register_private::unregister_global_property(const property_wrapper_ba
 bool type_register_private::register_method(const method_wrapper_base* meth)
 {
     const auto t    = meth->get_declaring_type();
-    const auto name = meth->get_name();
+    const auto name = meth->get_name_id();
     auto m          = create_item<::rttr::method>(meth);
 
     if (get_type_method(t, name, convert_param_list(meth->get_parameter_infos())))
         return false;
 
-    auto& method_list = t.m_type_data->m_class_data.m_methods;
+    auto& method_list = t.m_type_data->m_class_data.m_own_methods;
     method_list.emplace_back(m);
-    update_class_list(t, &class_data::m_methods);
+    invalidate_member_view(t);
     return true;
 }
 
@@ -853,36 +885,23 @@ bool type_register_private::register_method(const method_wrapper_base* meth)
 
 bool type_register_private::register_global_method(const method_wrapper_base* meth)
 {
-    const auto t    = meth->get_declaring_type();
-    const auto name = meth->get_name();
-    auto m          = create_item<::rttr::method>(meth);
-
-    if (t.get_global_method(name, convert_param_list(meth->get_parameter_infos())))
-        return false;
-
-    get_global_methods().push_back(m);
-    get_global_method_storage().insert(std::move(name), std::move(m));
-    return true;
+    return m_global_function_table.add_method(create_item<::rttr::method>(meth));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool type_register_private::unregister_global_method(const method_wrapper_base* meth)
 {
-    auto& g_meths   = get_global_method_storage();
-    auto result     = g_meths.erase(meth->get_name());
-
-    auto result2 = remove_container_item(get_global_methods(), create_item<rttr::method>(meth));
-    return result && result2;
+    return m_global_function_table.remove_method(create_item<rttr::method>(meth));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-property type_register_private::get_type_property(const type& t, string_view name)
+property type_register_private::get_type_property(const type& t, name_id name)
 {
-    for (const auto& prop : get_items_for_type(t, t.m_type_data->m_class_data.m_properties))
+    for (const auto& prop : t.m_type_data->m_class_data.m_own_properties)
     {
-        if (prop.get_name() == name)
+        if (prop.get_name_id() == name)
             return prop;
     }
 
@@ -891,12 +910,12 @@ property type_register_private::get_type_property(const type& t, string_view nam
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-method type_register_private::get_type_method(const type& t, string_view name,
+method type_register_private::get_type_method(const type& t, name_id name,
                                               const std::vector<type>& type_list)
 {
-    for (const auto& meth : get_items_for_type(t, t.m_type_data->m_class_data.m_methods))
+    for (const auto& meth : t.m_type_data->m_class_data.m_own_methods)
     {
-        if (meth.get_name() == name &&
+        if (meth.get_name_id() == name &&
             compare_with_type_list::compare(meth.get_parameter_infos(), type_list))
         {
             return meth;
@@ -909,32 +928,83 @@ method type_register_private::get_type_method(const type& t, string_view name,
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename T>
-void type_register_private::update_class_list(const type& t, T item_ptr)
+void type_register_private::update_class_list(const type& t, T own_item_ptr, T item_ptr)
 {
-    auto& all_class_items = (t.m_type_data->m_class_data.*item_ptr);
+    auto& data = t.m_type_data->m_class_data;
+    auto& all_class_items = (data.*item_ptr);
+    all_class_items.clear();
+
+    std::size_t base_item_count = 0;
+    for (const auto& base_type : data.m_base_types)
+        base_item_count += (base_type.m_type_data->m_class_data.*own_item_ptr).size();
 
-    // update type "t" with all items from the base classes
-    auto item_range = get_items_for_type(t, all_class_items);
-    detail::remove_cv_ref_t<decltype(all_class_items)> item_vec(item_range.begin(), item_range.end());
-    all_class_items.reserve(all_class_items.size() + 1);
-    all_class_items.clear(); // this will not reduce the capacity, i.e. new memory allocation may not necessary
-    for (const auto& base_type : t.get_base_classes())
+    // no base class has items, then the own items are used directly
+    if (base_item_count == 0)
     {
-        auto base_properties = get_items_for_type(base_type, base_type.m_type_data->m_class_data.*item_ptr);
-        if (base_properties.empty())
-            continue;
+        all_class_items.shrink_to_fit();
+        return;
+    }
 
-        all_class_items.reserve(all_class_items.size() + base_properties.size());
-        all_class_items.insert(all_class_items.end(), base_properties.begin(), base_properties.end());
+    const auto& own_items = (data.*own_item_ptr);
+    all_class_items.reserve(base_item_count + own_items.size());
+    // the base classes are ordered from base to derived
+    for (const auto& base_type : data.m_base_types)
+    {
+        const auto& base_items = (base_type.m_type_data->m_class_data.*own_item_ptr);
+        all_class_items.insert(all_class_items.end(), base_items.begin(), base_items.end());
     }
 
-    // insert own class items
-    all_class_items.reserve(all_class_items.size() + item_vec.size());
-    all_class_items.insert(all_class_items.end(), item_vec.begin(), item_vec.end());
+    all_class_items.insert(all_class_items.end(), own_items.begin(), own_items.end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::invalidate_member_view(const type& t)
+{
+    auto& data = t.m_type_data->m_class_data;
+    data.m_is_member_view_valid.store(false, std::memory_order_release);
+
+    // contains all derived classes, not only the direct ones
+    for (const auto& derived_type : data.m_derived_types)
+        derived_type.m_type_data->m_class_data.m_is_member_view_valid.store(false, std::memory_order_release);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::update_member_view(const type& t)
+{
+    auto& data = t.m_type_data->m_class_data;
+    if (data.m_is_member_view_valid.load(std::memory_order_acquire))
+        return;
+
+    std::lock_guard<std::mutex> lock(m_member_view_mutex);
+    if (data.m_is_member_view_valid.load(std::memory_order_relaxed))
+        return;
+
+    update_class_list(t, &class_data::m_own_properties, &class_data::m_properties);
+    update_class_list(t, &class_data::m_own_methods, &class_data::m_methods);
+
+    data.m_is_member_view_valid.store(true, std::memory_order_release);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<::rttr::property>& type_register_private::get_class_properties(const type& t)
+{
+    update_member_view(t);
+
+    const auto& data = t.m_type_data->m_class_data;
+    return (data.m_properties.empty() ? data.m_own_properties : data.m_properties);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<::rttr::method>& type_register_private::get_class_methods(const type& t)
+{
+    update_member_view(t);
 
-    // update derived types
-    for (const auto& derived_type : t.get_derived_classes())
-        update_class_list<T>(derived_type, item_ptr);
+    const auto& data = t.m_type_data->m_class_data;
+    return (data.m_methods.empty() ? data.m_own_methods : data.m_methods);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -1130,7 +1200,7 @@ flat_map<string_view, type>& type_register_private::get_orig_name_to_id()
 
 /////////////////////////////////////////////////////////////////////////////////////
 
-flat_map<std::string, type, hash>& type_register_private::get_custom_name_to_id()
+flat_map<name_id, type, hash>& type_register_private::get_custom_name_to_id()
 {
     return m_custom_name_to_id;
 }
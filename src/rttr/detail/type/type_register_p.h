@@ -29,18 +29,20 @@
 #define RTTR_TYPE_REGISTER_P_H_
 
 #include "rttr/detail/base/core_prerequisites.h"
-#include "rttr/detail/misc/flat_multimap.h"
 #include "rttr/detail/misc/flat_map.h"
+#include "rttr/detail/type/global_function_table.h"
 #include "rttr/enumeration.h"
 #include "rttr/variant.h"
 #include "rttr/detail/metadata/metadata.h"
 
 #include "rttr/string_view.h"
+#include "rttr/name_id.h"
 
 #include <memory>
 #include <string>
 #include <vector>
 #include <mutex>
+#include <unordered_map>
 
 namespace rttr
 {
@@ -90,20 +92,26 @@ public:
     void register_custom_name(type& t, string_view custom_name);
 
     /////////////////////////////////////////////////////////////////////////////////////
-    flat_multimap<string_view, ::rttr::property>& get_global_property_storage();
-    flat_multimap<string_view, ::rttr::method>& get_global_method_storage();
+    global_function_table& get_global_function_table();
     /////////////////////////////////////////////////////////////////////////////////////
 
     /////////////////////////////////////////////////////////////////////////////////////
-    std::vector<::rttr::method>& get_global_methods();
-    std::vector<::rttr::property>& get_global_properties();
+    //! Returns the properties of \p t, including the ones of its base classes (ordered from base to derived)
+    const std::vector<::rttr::property>& get_class_properties(const type& t);
+    //! Returns the methods of \p t, including the ones of its base classes (ordered from base to derived)
+    const std::vector<::rttr::method>& get_class_methods(const type& t);
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    /////////////////////////////////////////////////////////////////////////////////////
+    const std::vector<::rttr::method>& get_global_methods();
+    const std::vector<::rttr::property>& get_global_properties();
 
     /////////////////////////////////////////////////////////////////////////////////////
 
     std::vector<type_data*>& get_type_data_storage();
     std::vector<type>& get_type_storage();
     flat_map<string_view, type>& get_orig_name_to_id();
-    flat_map<std::string, type, hash>& get_custom_name_to_id();
+    flat_map<name_id, type, hash>& get_custom_name_to_id();
 
     /////////////////////////////////////////////////////////////////////////////////////
 
@@ -176,12 +184,17 @@ private:
     static const type_comparator_base* get_type_comparator_impl(const type& t,
                                                                 const std::vector<data_container<const type_comparator_base*>>& comparator_list);
 
-    static ::rttr::property get_type_property(const type& t, string_view name);
-    static ::rttr::method get_type_method(const type& t, string_view name,
+    static ::rttr::property get_type_property(const type& t, name_id name);
+    static ::rttr::method get_type_method(const type& t, name_id name,
                                           const std::vector<type>& type_list);
 
+    //! Invalidates the flattened member view of \p t and all its derived classes
+    static void invalidate_member_view(const type& t);
+    //! Builds the flattened member view of \p t, when necessary
+    void update_member_view(const type& t);
+
     template<typename T>
-    static void update_class_list(const type& t, T item_ptr);
+    static void update_class_list(const type& t, T own_item_ptr, T item_ptr);
 
     static std::string derive_name(const type& t);
     //! Returns true, when the name was already registered
@@ -200,6 +213,21 @@ private:
      */
     void update_custom_name(std::string new_name, const type& t);
 
+    /*!
+     * Returns all types, from which the name of the given type \p t is derived.
+     * That is the raw type of a pointer, the raw type of an array or the template arguments of a template instance.
+     */
+    static std::vector<type> get_name_source_types(const type& t);
+
+    //! Adds the given type \p t to the name dependency index of all its name source types
+    void register_name_dependencies(const type& t);
+
+    //! Removes the given type \p t from the name dependency index
+    void unregister_name_dependencies(const type& t);
+
+    //! Derives the name of \p t again from its name source types, returns true when the name has changed
+    bool update_derived_name(const type& t);
+
     //! This will remove from all base classes the derived types (e.g. because of type unloaded)
     void remove_derived_types_from_base_classes(type& t, const std::vector<type>& base_types);
 
@@ -213,21 +241,21 @@ private:
      */
     std::set<registration_manager*>                             m_registration_manager_list;
 
-    flat_map<std::string, type, hash>                           m_custom_name_to_id;
+    flat_map<name_id, type, hash>                               m_custom_name_to_id;
     flat_map<string_view, type>                                 m_orig_name_to_id;
+    //! reverse index, contains for every type all types which embed its name (pointer, array and template instance types)
+    std::unordered_map<const type_data*, std::vector<type>>     m_name_dependent_types;
     std::vector<type>                                           m_type_list;
     std::vector<type_data*>                                     m_type_data_storage;
 
-    flat_multimap<string_view, ::rttr::property>                m_global_property_stroage;
-    flat_multimap<string_view, ::rttr::method>                  m_global_method_stroage;
-    std::vector<::rttr::property>                               m_global_properties;
-    std::vector<::rttr::method>                                 m_global_methods;
+    global_function_table                                       m_global_function_table;
 
     std::vector<data_container<const type_converter_base*>>     m_type_converter_list;
     std::vector<data_container<const type_comparator_base*>>    m_type_equal_cmp_list;
     std::vector<data_container<const type_comparator_base*>>    m_type_less_than_cmp_list;
 
     std::mutex                                                  m_mutex;
+    std::mutex                                                  m_member_view_mutex;
 };
 
 } // end namespace detail
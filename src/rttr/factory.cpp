@@ -0,0 +1,191 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/factory.h"
+
+#include "rttr/constructor.h"
+#include "rttr/destructor.h"
+#include "rttr/detail/constructor/constructor_wrapper_base.h"
+#include "rttr/argument.h"
+#include "rttr/type.h"
+#include "rttr/variant.h"
+
+#include <utility>
+
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// the memory of the object belongs to the memory resource, it is returned after the object was destroyed
+struct resource_deleter
+{
+    rttr::destructor            m_dtor;
+    std::pmr::memory_resource*  m_resource;
+    std::size_t                 m_size;
+    std::size_t                 m_alignment;
+
+    void operator()(void* obj) const RTTR_NOEXCEPT
+    {
+        m_dtor.invoke_at(obj);
+        m_resource->deallocate(obj, m_size, m_alignment);
+    }
+};
+
+} // end namespace anonymous
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+factory::factory() RTTR_NOEXCEPT
+:   m_wrapper(nullptr)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+factory::factory(const detail::constructor_wrapper_base* wrapper) RTTR_NOEXCEPT
+:   m_wrapper(wrapper)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool factory::is_valid() const RTTR_NOEXCEPT
+{
+    return (m_wrapper != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+factory::operator bool() const RTTR_NOEXCEPT
+{
+    return (m_wrapper != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+constructor factory::get_constructor() const RTTR_NOEXCEPT
+{
+    if (m_wrapper)
+        return detail::create_item<constructor>(m_wrapper);
+
+    return detail::create_invalid_item<constructor>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type factory::get_declaring_type() const RTTR_NOEXCEPT
+{
+    if (m_wrapper)
+        return m_wrapper->get_declaring_type();
+
+    return detail::get_invalid_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant factory::create(std::vector<argument> args) const
+{
+    if (!m_wrapper || !m_wrapper->get_parameter_signature().matches(args))
+        return variant();
+
+    return m_wrapper->invoke_variadic(args);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::shared_ptr<void> factory::create_shared(std::vector<argument> args, const type& target_type) const
+{
+    if (!m_wrapper)
+        return std::shared_ptr<void>();
+
+    auto obj = m_wrapper->invoke_shared(args);
+    if (!obj)
+        return obj;
+
+    const auto source_type = m_wrapper->get_declaring_type();
+    void* ptr = type::apply_offset(obj.get(), source_type, target_type);
+    if (!ptr)
+        return std::shared_ptr<void>();
+
+    // aliasing constructor, the control block still owns the object of the declaring type
+    return std::shared_ptr<void>(std::move(obj), ptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::shared_ptr<void> factory::allocate_shared(std::pmr::memory_resource* resource, std::vector<argument> args,
+                                               const type& target_type) const
+{
+    if (!m_wrapper || !resource)
+        return std::shared_ptr<void>();
+
+    const auto source_type = m_wrapper->get_declaring_type();
+    const auto dtor = source_type.get_destructor();
+    if (!dtor || !source_type.is_derived_from(target_type))
+        return std::shared_ptr<void>();
+
+    const auto size         = source_type.get_sizeof();
+    const auto alignment    = source_type.get_alignof();
+    void* storage = resource->allocate(size, alignment);
+    if (!m_wrapper->invoke_at(storage, args.data(), args.size()))
+    {
+        resource->deallocate(storage, size, alignment);
+        return std::shared_ptr<void>();
+    }
+
+    std::shared_ptr<void> obj(storage, resource_deleter{dtor, resource, size, alignment},
+                              std::pmr::polymorphic_allocator<char>(resource));
+
+    void* ptr = type::apply_offset(storage, source_type, target_type);
+    if (!ptr)
+        return std::shared_ptr<void>();
+
+    return std::shared_ptr<void>(std::move(obj), ptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool factory::operator==(const factory& other) const RTTR_NOEXCEPT
+{
+    return (m_wrapper == other.m_wrapper);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool factory::operator!=(const factory& other) const RTTR_NOEXCEPT
+{
+    return (m_wrapper != other.m_wrapper);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
@@ -0,0 +1,198 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_FACTORY_H_
+#define RTTR_FACTORY_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/class_item_mapper.h"
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace rttr
+{
+
+class variant;
+class type;
+class argument;
+class constructor;
+
+/*!
+ * The \ref factory class is a handle to one resolved constructor of a type.
+ *
+ * A \ref factory can only be obtained from the \ref type class, see \ref type::get_factory().
+ * The constructor is looked up exactly once, when the handle is created.
+ * Every following call of \ref create() or \ref create_shared() skips the search over all registered constructors
+ * and checks the given arguments only against the cached parameter types.
+ *
+ * Use \ref create_shared() in order to retrieve the new object directly as `std::shared_ptr`,
+ * without wrapping it inside a \ref variant and converting it afterwards.
+ *
+ * Copying and Assignment
+ * ----------------------
+ * A \ref factory object is lightweight and can be copied by value. However, each copy will refer to the same underlying constructor.
+ *
+ * Typical Usage
+ * ----------------------
+ *
+ * \code{.cpp}
+ *      static const factory node_factory = type::get_by_name("scene_node").get_factory({type::get<int>()});
+ *
+ *      for (int i = 0; i < 1000; ++i)
+ *      {
+ *          std::shared_ptr<node_base> node = node_factory.create_shared<node_base>({i});
+ *          ...
+ *      }
+ * \endcode
+ *
+ * \see constructor, type::get_factory()
+ */
+class RTTR_API factory
+{
+    public:
+        /*!
+         * \brief Constructs an invalid factory.
+         */
+        factory() RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true if this factory is valid, otherwise false.
+         *
+         * \return True if this factory is valid, otherwise false.
+         */
+        bool is_valid() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Convenience function to check if this factory is valid or not.
+         *
+         * \return True if this factory is valid, otherwise false.
+         */
+        explicit operator bool() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the resolved constructor of this factory.
+         *
+         * \return The constructor, or an invalid constructor when this factory is not valid.
+         */
+        constructor get_constructor() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the \ref type of the class, which will be created with this factory.
+         *
+         * \return The type of the created object.
+         */
+        type get_declaring_type() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Creates a new object with the given arguments \p args.
+         *
+         * \remark The object will be created with the policy, which was used during registration of the constructor.
+         *         Constructors with registered \ref default_arguments will be honored.
+         *
+         * \return The new object, or an invalid variant when the arguments does not match.
+         */
+        variant create(std::vector<argument> args = std::vector<argument>()) const;
+
+        /*!
+         * \brief Creates a new object with the given arguments \p args, owned by a `std::shared_ptr`.
+         *
+         * The object is created directly into the `std::shared_ptr`, independent of the registered constructor policy.
+         * The returned pointer is adjusted to the given \p target_type, which has to be the declaring type or one of its base classes.
+         *
+         * \remark This works only for constructors registered with \ref registration::class_<T>::constructor() "constructor<Args...>()",
+         *         and with all arguments provided. For custom creator functions, an empty pointer is returned.
+         *
+         * \return The new object, or an empty pointer when the arguments or \p target_type does not match.
+         */
+        std::shared_ptr<void> create_shared(std::vector<argument> args, const type& target_type) const;
+
+        /*!
+         * \brief Creates a new object with the given arguments \p args, owned by a `std::shared_ptr<T>`.
+         *
+         * \see create_shared(std::vector<argument>, const type&) const
+         *
+         * \return The new object, or an empty pointer when the arguments does not match.
+         */
+        template<typename T>
+        std::shared_ptr<T> create_shared(std::vector<argument> args = std::vector<argument>()) const;
+
+        /*!
+         * \brief Creates a new object with the given arguments \p args, the memory is allocated from the given \p resource.
+         *
+         * The object is constructed in place (see \ref constructor::invoke_at()) inside memory of \p resource,
+         * the control block of the returned `std::shared_ptr` is allocated from the same \p resource.
+         * When a `std::pmr::monotonic_buffer_resource` is used, objects created one after another are placed
+         * contiguously in memory.
+         *
+         * \remark The \p resource has to outlive the returned pointer.
+         *         Custom creator functions cannot construct in place, then an empty pointer is returned.
+         *
+         * \see create_shared(std::vector<argument>, const type&) const
+         *
+         * \return The new object, or an empty pointer when the arguments or \p target_type does not match.
+         */
+        std::shared_ptr<void> allocate_shared(std::pmr::memory_resource* resource, std::vector<argument> args,
+                                              const type& target_type) const;
+
+        /*!
+         * \brief Creates a new object with the given arguments \p args, the memory is allocated from the given \p resource.
+         *
+         * \see allocate_shared(std::pmr::memory_resource*, std::vector<argument>, const type&) const
+         *
+         * \return The new object, or an empty pointer when the arguments does not match.
+         */
+        template<typename T>
+        std::shared_ptr<T> allocate_shared(std::pmr::memory_resource* resource,
+                                           std::vector<argument> args = std::vector<argument>()) const;
+
+        /*!
+         * \brief Returns true if this factory refers to the same constructor like the \p other.
+         */
+        bool operator==(const factory& other) const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true if this factory refers to a different constructor like the \p other.
+         */
+        bool operator!=(const factory& other) const RTTR_NOEXCEPT;
+
+    private:
+        factory(const detail::constructor_wrapper_base* wrapper) RTTR_NOEXCEPT;
+
+        friend class type;
+
+    private:
+        const detail::constructor_wrapper_base* m_wrapper;
+};
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/factory_impl.h"
+
+#endif // RTTR_FACTORY_H_
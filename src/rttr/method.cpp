@@ -85,6 +85,13 @@ string_view method::get_name() const RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+name_id method::get_name_id() const RTTR_NOEXCEPT
+{
+    return m_wrapper->get_name_id();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 access_levels method::get_access_level() const RTTR_NOEXCEPT
 {
     return m_wrapper->get_access_level();
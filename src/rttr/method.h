@@ -34,6 +34,7 @@
 #include "rttr/access_levels.h"
 #include "rttr/array_range.h"
 #include "rttr/string_view.h"
+#include "rttr/name_id.h"
 
 #include <string>
 #include <vector>
@@ -142,6 +143,13 @@ class RTTR_API method
          */
         string_view get_name() const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns the interned name handle of this method.
+         *
+         * \return The name handle of the method.
+         */
+        name_id get_name_id() const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns the access level with which this method was
          *        \ref registration::class_<T>::method() "registered".
@@ -0,0 +1,107 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/name_id.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * The process wide storage of all interned names.
+ *
+ * The table is keyed by the precomputed hash of a name, so a string is hashed only once per \ref name_id construction.
+ * The strings are allocated separately, so that the pointers handed out to \ref name_id stay valid on rehash.
+ *
+ * \remark The table is allocated on the heap and intentionally never destroyed.
+ *         Registration managers are static objects, which unregister their types at exit.
+ *         They must be able to create or compare names, regardless of the destruction order of static objects.
+ */
+struct RTTR_LOCAL name_table
+{
+    static name_table& get_instance()
+    {
+        static name_table* obj = new name_table;
+        return *obj;
+    }
+
+    struct identity_hash
+    {
+        std::size_t operator()(std::size_t value) const RTTR_NOEXCEPT { return value; }
+    };
+
+    std::unordered_multimap<std::size_t, std::unique_ptr<std::string>, identity_hash>   m_names;
+    std::mutex                                                                          m_mutex;
+};
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+name_id::name_id(string_view name)
+:   m_data(nullptr),
+    m_size(0),
+    m_hash(detail::generate_hash(name.data(), name.size()))
+{
+    if (name.empty())
+        return;
+
+    auto& table = detail::name_table::get_instance();
+    std::lock_guard<std::mutex> lock(table.m_mutex);
+
+    const std::string* interned_name = nullptr;
+    auto range = table.m_names.equal_range(m_hash);
+    for (auto itr = range.first; itr != range.second; ++itr)
+    {
+        if (string_view(*itr->second) == name)
+        {
+            interned_name = itr->second.get();
+            break;
+        }
+    }
+
+    if (!interned_name)
+    {
+        auto str = detail::make_unique<std::string>(name.to_string());
+        interned_name = str.get();
+        table.m_names.emplace(m_hash, std::move(str));
+    }
+
+    m_data = interned_name->data();
+    m_size = interned_name->size();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
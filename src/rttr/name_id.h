@@ -0,0 +1,156 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_NAME_ID_H_
+#define RTTR_NAME_ID_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/string_view.h"
+
+#include <cstddef>
+
+namespace rttr
+{
+
+/*!
+ * The \ref name_id class is a precomputed handle to an interned name.
+ *
+ * Creating a \ref name_id from a string hashes the string once and looks it up
+ * in a process wide name table. Every \ref name_id created from the same character sequence
+ * refers to the same table entry, so two handles can be compared by a single pointer comparison.
+ *
+ * The lookup functions of \ref type accept a \ref name_id instead of a \ref string_view.
+ * These overloads neither hash the given name again, nor compare strings.
+ * Create the handle once and reuse it, when the same name is looked up repeatedly, e.g. in a dispatch loop.
+ *
+ * Typical Usage
+ * -------------
+ *
+ * \code{.cpp}
+ *      static const name_id update_id("update");
+ *
+ *      for (auto& obj : objects)
+ *      {
+ *          method meth = type::get(obj).get_method(update_id);
+ *          meth.invoke(obj, delta_time);
+ *      }
+ * \endcode
+ *
+ * \remark Constructing a \ref name_id from a string is comparatively expensive: it hashes the string
+ *         and acquires a process wide lock to search and extend the name table.
+ *         This also happens during registration and unregistration of properties and methods.
+ *         Copying, comparing and hashing an existing handle is cheap and lock free.
+ *         Therefore do not create the handles inside of a hot loop, create them upfront and reuse them.
+ *
+ * \remark The name table never shrinks. Every distinct name, which is used to create a \ref name_id,
+ *         stays in memory until the process exits.
+ *
+ * Copying and Assignment
+ * ----------------------
+ * A \ref name_id object is lightweight and can be copied by value.
+ */
+class RTTR_API name_id
+{
+    public:
+        /*!
+         * \brief Constructs an invalid name_id object.
+         */
+        RTTR_INLINE name_id() RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Constructs a name_id object for the given name \p name.
+         *
+         * \remark An empty \p name will result in an invalid name_id.
+         *
+         * \remark This constructor acquires the lock of the process wide name table.
+         */
+        explicit name_id(string_view name);
+
+        /*!
+         * \brief Returns the name this handle refers to.
+         *
+         * \remark The returned string is valid for the whole lifetime of the process.
+         *
+         * \return The name of the handle.
+         */
+        RTTR_INLINE string_view get_name() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the precomputed hash value of the name.
+         *
+         * \remark The value is identical to the hash of a \ref string_view with the same content.
+         *
+         * \return The hash value.
+         */
+        RTTR_INLINE std::size_t get_hash() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true if this name_id refers to a name, otherwise false.
+         *
+         * \return True if this name_id is valid, otherwise false.
+         */
+        RTTR_INLINE bool is_valid() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Convenience function to check if this name_id is valid or not.
+         *
+         * \return True if this name_id is valid, otherwise false.
+         */
+        RTTR_INLINE explicit operator bool() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true if both handles refer to the same name, otherwise false.
+         *
+         * \remark This is a pointer comparison, no strings will be compared.
+         */
+        RTTR_INLINE bool operator==(const name_id& other) const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true if both handles refer to different names, otherwise false.
+         */
+        RTTR_INLINE bool operator!=(const name_id& other) const RTTR_NOEXCEPT;
+
+    private:
+        const char* m_data;
+        std::size_t m_size;
+        std::size_t m_hash;
+};
+
+/*!
+ * \brief Compares the name of the handle \p lhs with the string \p rhs.
+ */
+RTTR_INLINE bool operator==(const name_id& lhs, string_view rhs) RTTR_NOEXCEPT;
+RTTR_INLINE bool operator==(string_view lhs, const name_id& rhs) RTTR_NOEXCEPT;
+RTTR_INLINE bool operator!=(const name_id& lhs, string_view rhs) RTTR_NOEXCEPT;
+RTTR_INLINE bool operator!=(string_view lhs, const name_id& rhs) RTTR_NOEXCEPT;
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/name_id_impl.h"
+
+#endif // RTTR_NAME_ID_H_
@@ -4,6 +4,7 @@
 #include "rttr/type.h"
 
 #include <memory>
+#include <memory_resource>
 #include <vector>
 
 namespace rttr
@@ -11,6 +12,7 @@ namespace rttr
 
 class variant;
 class argument;
+class factory;
 template<typename T>
 class polymoph_ptr;
 
@@ -251,8 +253,30 @@ public:
     bool empty() const { return is_valid(); }
 
     bool create(std::string type_name, std::vector<argument> args = std::vector<argument>());
+    // 使用预先解析的 factory, 跳过按名字查找构造函数
+    bool create(const factory& obj_factory, std::vector<argument> args = std::vector<argument>());
 
     static polymoph_ptr<T> make(std::string type_name, std::vector<argument> args = std::vector<argument>());
+    static polymoph_ptr<T> make(const factory& obj_factory, std::vector<argument> args = std::vector<argument>());
+
+    // 对象和控制块都从 resource 分配, 使用 std::pmr::monotonic_buffer_resource 时, 批量创建的对象在内存中是连续的
+    // resource 的生命周期必须长于所有创建出来的对象
+    bool create(std::pmr::memory_resource* resource, const factory& obj_factory, std::vector<argument> args = std::vector<argument>());
+    static polymoph_ptr<T> make(std::pmr::memory_resource* resource, const factory& obj_factory, std::vector<argument> args = std::vector<argument>());
+
+    // 编译期已知类型时使用 std::allocate_shared, 对象和控制块只分配一次, 例如:
+    // polymoph_ptr<node>::allocate<sub_node>(std::pmr::polymorphic_allocator<sub_node>(&arena), 42);
+    template<typename U, typename Alloc, typename... Args,
+             detail::enable_if_t<std::is_base_of<value_type, U>::value, bool> = true>
+    static polymoph_ptr<T> allocate(const Alloc& alloc, Args&&... args) {
+        polymoph_ptr<T> result;
+        result.m_real_type = type::get<U>();
+        result.m_real_ptr_type = type::get<U*>();
+        if (result.m_real_type) {
+            result.m_value = std::static_pointer_cast<value_type>(std::allocate_shared<U>(alloc, std::forward<Args>(args)...));
+        }
+        return result;
+    }
 
 private:
     type                        m_real_type { detail::get_invalid_type() };
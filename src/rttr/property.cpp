@@ -121,6 +121,13 @@ string_view property::get_name() const RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+name_id property::get_name_id() const RTTR_NOEXCEPT
+{
+    return m_wrapper->get_name_id();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 type property::get_type() const RTTR_NOEXCEPT
 {
     return m_wrapper->get_type();
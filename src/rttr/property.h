@@ -33,6 +33,7 @@
 #include "rttr/parameter_info.h"
 #include "rttr/access_levels.h"
 #include "rttr/string_view.h"
+#include "rttr/name_id.h"
 
 #include <string>
 
@@ -188,6 +189,15 @@ class RTTR_API property
          */
         string_view get_name() const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns the interned name handle of this property.
+         *
+         * \remark When the property is not valid, this function will return an invalid name_id.
+         *
+         * \return The name handle of the property.
+         */
+        name_id get_name_id() const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns the underlying \ref type object of this property.
          *
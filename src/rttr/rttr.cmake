@@ -33,10 +33,12 @@ set(HEADER_FILES access_levels.h
                  destructor.h
                  enumeration.h
                  enum_flags.h
+                 factory.h
                  filter_item.h
                  instance.h
                  library.h
                  method.h
+                 name_id.h
                  policy.h
                  property.h
                  parameter_info.h
@@ -88,7 +90,9 @@ set(HEADER_FILES access_levels.h
                  detail/impl/array_range_impl.h
                  detail/impl/associative_mapper_impl.h
                  detail/impl/enum_flags_impl.h
+                 detail/impl/factory_impl.h
                  detail/impl/instance_impl.h
+                 detail/impl/name_id_impl.h
                  detail/impl/rttr_cast_impl.h
                  detail/impl/sequential_mapper_impl.h
                  detail/impl/string_view_impl.h
@@ -120,6 +124,7 @@ set(HEADER_FILES access_levels.h
                  detail/parameter_info/parameter_infos.h
                  detail/parameter_info/parameter_infos_compare.h
                  detail/parameter_info/parameter_names.h
+                 detail/parameter_info/parameter_signature.h
                  detail/parameter_info/parameter_info_wrapper_base.h
                  detail/parameter_info/parameter_info_wrapper.h
                  detail/policies/prop_policies.h
@@ -143,6 +148,7 @@ set(HEADER_FILES access_levels.h
                  detail/type/base_classes.h
                  detail/type/get_create_variant_func.h
                  detail/type/get_derived_info_func.h
+                 detail/type/global_function_table.h
                  detail/type/type_converter.h
                  detail/type/type_comparator.h
                  detail/type/type_data.h
@@ -179,8 +185,10 @@ set(HEADER_FILES access_levels.h
 set(SOURCE_FILES constructor.cpp
                  destructor.cpp
                  enumeration.cpp
+                 factory.cpp
                  library.cpp
                  method.cpp
+                 name_id.cpp
                  parameter_info.cpp
                  policy.cpp
                  property.cpp
@@ -206,6 +214,7 @@ set(SOURCE_FILES constructor.cpp
                  detail/property/property_wrapper_base.cpp
                  detail/registration/registration_executer.cpp
                  detail/registration/registration_state_saver.cpp
+                 detail/type/global_function_table.cpp
                  detail/type/type_data.cpp
                  detail/type/type_register.cpp
                  detail/variant/variant_compare.cpp
@@ -31,6 +31,7 @@
 #include "rttr/property.h"
 #include "rttr/destructor.h"
 #include "rttr/enumeration.h"
+#include "rttr/factory.h"
 #include "rttr/method.h"
 
 #include "rttr/detail/constructor/constructor_wrapper_base.h"
@@ -56,9 +57,82 @@
 #include <utility>
 
 
-
 namespace rttr
 {
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE const std::vector<property>& get_class_properties(const type& t)
+{
+    return detail::type_register_private::get_instance().get_class_properties(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE const std::vector<method>& get_class_methods(const type& t)
+{
+    return detail::type_register_private::get_instance().get_class_methods(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool is_same_name(const T& item, string_view name) RTTR_NOEXCEPT
+{
+    return (item.get_name() == name);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool is_same_name(const T& item, name_id name) RTTR_NOEXCEPT
+{
+    return (item.get_name_id() == name);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Name>
+RTTR_INLINE T find_class_item(const std::vector<T>& vec, const Name& name) RTTR_NOEXCEPT
+{
+    // items are ordered from base to derived
+    // use reverse iterator to find the most-derived item
+    // when searching instance registry by name
+    auto ret = std::find_if(vec.crbegin(), vec.crend(),
+                            [&name](const T& item)
+                            {
+                                return is_same_name(item, name);
+                            });
+    if (ret != vec.crend())
+        return *ret;
+
+    return detail::create_invalid_item<T>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Name>
+RTTR_INLINE method find_class_method(const std::vector<method>& methvec, const Name& name,
+                                     const std::vector<type>& type_list) RTTR_NOEXCEPT
+{
+    for (auto mit = methvec.crbegin() ; mit != methvec.crend() ; ++mit)
+    {
+        const auto& meth = *mit ;
+        if ( is_same_name(meth, name) &&
+             detail::compare_with_type_list::compare(meth.get_parameter_infos(), type_list))
+        {
+            return meth;
+        }
+    }
+
+    return detail::create_invalid_item<method>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end anonymous namespace
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -197,8 +271,8 @@ variant type::create(std::vector<argument> args) const
     auto& ctors = m_type_data->m_class_data.m_ctors;
     for (const auto& ctor : ctors)
     {
-        if (detail::compare_with_arg_list::compare(ctor.get_parameter_infos(), args))
-            return ctor.invoke_variadic(std::move(args));
+        if (ctor.m_wrapper->get_parameter_signature().matches(args))
+            return ctor.m_wrapper->invoke_variadic(args);
     }
 
     return variant();
@@ -220,20 +294,14 @@ bool type::destroy(variant& obj) const RTTR_NOEXCEPT
 
 property type::get_property(string_view name) const RTTR_NOEXCEPT
 {
-    const auto raw_t = get_raw_type();
-    const auto& vec = raw_t.m_type_data->m_class_data.m_properties;
-    // properties are ordered from base to derived
-    // use reverse iterator to find the most-derived propertie
-    // when searching instance registry by name
-    auto ret = std::find_if(vec.crbegin(), vec.crend(),
-                            [name](const property& item)
-                            {
-                                return (item.get_name() == name);
-                            });
-    if (ret != vec.crend())
-        return *ret;
+    return find_class_item(get_class_properties(get_raw_type()), name);
+}
 
-    return detail::create_invalid_item<property>();
+/////////////////////////////////////////////////////////////////////////////////////////
+
+property type::get_property(name_id name) const RTTR_NOEXCEPT
+{
+    return find_class_item(get_class_properties(get_raw_type()), name);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -271,7 +339,7 @@ bool type::set_property_value(string_view name, argument arg)
 
 array_range<property> type::get_properties() const RTTR_NOEXCEPT
 {
-    auto& vec = get_raw_type().m_type_data->m_class_data.m_properties;
+    auto& vec = get_class_properties(get_raw_type());
     if (!vec.empty())
     {
         return array_range<property>(vec.data(), vec.size(),
@@ -289,7 +357,7 @@ array_range<property> type::get_properties() const RTTR_NOEXCEPT
 array_range<property> type::get_properties(filter_items filter) const RTTR_NOEXCEPT
 {
     const auto raw_t = get_raw_type();
-    auto& vec = raw_t.m_type_data->m_class_data.m_properties;
+    auto& vec = get_class_properties(raw_t);
     if (!vec.empty())
         return array_range<property>(vec.data(), vec.size(), detail::get_filter_predicate<property>(raw_t, filter));
 
@@ -300,39 +368,28 @@ array_range<property> type::get_properties(filter_items filter) const RTTR_NOEXC
 
 method type::get_method(string_view name) const RTTR_NOEXCEPT
 {
-    const auto raw_t = get_raw_type();
-    const auto& vec = raw_t.m_type_data->m_class_data.m_methods;
-    // methods appear are ordered from base to derived
-    // use reverse iterator to find the most-derived method
-    // when searching instance registry by name
-    auto ret = std::find_if(vec.crbegin(), vec.crend(),
-                            [name](const method& item)
-                            {
-                                return (item.get_name() == name);
-                            });
-    if (ret != vec.crend())
-        return *ret;
+    return find_class_item(get_class_methods(get_raw_type()), name);
+}
 
-    return detail::create_invalid_item<method>();
+/////////////////////////////////////////////////////////////////////////////////////////
+
+method type::get_method(name_id name) const RTTR_NOEXCEPT
+{
+    return find_class_item(get_class_methods(get_raw_type()), name);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 method type::get_method(string_view name, const std::vector<type>& type_list) const RTTR_NOEXCEPT
 {
-    const auto raw_t = get_raw_type();
-    const auto& methvec = raw_t.m_type_data->m_class_data.m_methods;
-    for (auto mit = methvec.crbegin() ; mit != methvec.crend() ; ++mit)
-    {
-        const auto& meth = *mit ;
-        if ( meth.get_name() == name &&
-             detail::compare_with_type_list::compare(meth.get_parameter_infos(), type_list))
-        {
-            return meth;
-        }
-    }
+    return find_class_method(get_class_methods(get_raw_type()), name, type_list);
+}
 
-    return detail::create_invalid_item<method>();
+/////////////////////////////////////////////////////////////////////////////////////////
+
+method type::get_method(name_id name, const std::vector<type>& type_list) const RTTR_NOEXCEPT
+{
+    return find_class_method(get_class_methods(get_raw_type()), name, type_list);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -340,7 +397,7 @@ method type::get_method(string_view name, const std::vector<type>& type_list) co
 array_range<method> type::get_methods() const RTTR_NOEXCEPT
 {
     const auto raw_t = get_raw_type();
-    auto& vec = raw_t.m_type_data->m_class_data.m_methods;
+    auto& vec = get_class_methods(raw_t);
     if (!vec.empty())
     {
         return array_range<method>(vec.data(), vec.size(),
@@ -358,7 +415,7 @@ array_range<method> type::get_methods() const RTTR_NOEXCEPT
 array_range<method> type::get_methods(filter_items filter) const RTTR_NOEXCEPT
 {
     const auto raw_t = get_raw_type();
-    auto& vec = raw_t.m_type_data->m_class_data.m_methods;
+    auto& vec = get_class_methods(raw_t);
     if (!vec.empty())
         return array_range<method>(vec.data(), vec.size(), detail::get_filter_predicate<method>(raw_t, filter));
 
@@ -369,45 +426,42 @@ array_range<method> type::get_methods(filter_items filter) const RTTR_NOEXCEPT
 
 property type::get_global_property(string_view name) RTTR_NOEXCEPT
 {
-    auto& prop_list = detail::type_register_private::get_instance().get_global_property_storage();
-    const auto ret = prop_list.find(name);
-    if (ret != prop_list.end())
-        return *ret;
+    return detail::type_register_private::get_instance().get_global_function_table().find_property(name);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
 
-    return detail::create_invalid_item<property>();
+property type::get_global_property(name_id name) RTTR_NOEXCEPT
+{
+    return detail::type_register_private::get_instance().get_global_function_table().find_property(name);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 method type::get_global_method(string_view name) RTTR_NOEXCEPT
 {
-    auto& meth_list = detail::type_register_private::get_instance().get_global_method_storage();
-    const auto ret = meth_list.find(name);
-    if (ret != meth_list.end())
-        return *ret;
+    return detail::type_register_private::get_instance().get_global_function_table().find_method(name);
+}
 
-    return detail::create_invalid_item<method>();
+/////////////////////////////////////////////////////////////////////////////////////////
+
+method type::get_global_method(name_id name) RTTR_NOEXCEPT
+{
+    return detail::type_register_private::get_instance().get_global_function_table().find_method(name);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 method type::get_global_method(string_view name, const std::vector<type>& type_list) RTTR_NOEXCEPT
 {
-    auto& meth_list = detail::type_register_private::get_instance().get_global_method_storage();
-    auto itr = meth_list.find(name);
-    while (itr != meth_list.end())
-    {
-        const auto& meth = *itr;
-        if (meth.get_name() != name)
-            break;
-
-        if (detail::compare_with_type_list::compare(meth.get_parameter_infos(), type_list))
-            return meth;
+    return detail::type_register_private::get_instance().get_global_function_table().find_method(name, type_list);
+}
 
-        ++itr;
-    }
+/////////////////////////////////////////////////////////////////////////////////////////
 
-    return detail::create_invalid_item<method>();
+method type::get_global_method(name_id name, const std::vector<type>& type_list) RTTR_NOEXCEPT
+{
+    return detail::type_register_private::get_instance().get_global_function_table().find_method(name, type_list);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -441,7 +495,7 @@ enumeration type::get_enumeration() const RTTR_NOEXCEPT
 variant type::invoke(string_view name, instance obj, std::vector<argument> args) const
 {
     const auto raw_t = get_raw_type();
-    const auto& methvec = raw_t.m_type_data->m_class_data.m_methods;
+    const auto& methvec = get_class_methods(raw_t);
     for (auto mit = methvec.crbegin() ; mit != methvec.crend() ; ++mit)
     {
         const auto& meth = *mit ;
@@ -459,21 +513,22 @@ variant type::invoke(string_view name, instance obj, std::vector<argument> args)
 
 variant type::invoke(string_view name, std::vector<argument> args)
 {
-    auto& meth_list = detail::type_register_private::get_instance().get_global_method_storage();
-    auto itr = meth_list.find(name);
-    while (itr != meth_list.end())
-    {
-        const auto& meth = *itr;
-        if (meth.get_name() != name)
-            break;
+    const auto& table = detail::type_register_private::get_instance().get_global_function_table();
+    const auto meth = table.find_method(name, args);
+    if (meth)
+        return meth.invoke_variadic(instance(), args);
 
-        if (detail::compare_with_arg_list::compare(meth.get_parameter_infos(), args))
-        {
-            return meth.invoke_variadic(instance(), args);
-        }
+    return variant();
+}
 
-        ++itr;
-    }
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant type::invoke(name_id name, std::vector<argument> args)
+{
+    const auto& table = detail::type_register_private::get_instance().get_global_function_table();
+    const auto meth = table.find_method(name, args);
+    if (meth)
+        return meth.invoke_variadic(instance(), args);
 
     return variant();
 }
@@ -492,6 +547,18 @@ type type::get_by_name(string_view name) RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+type type::get_by_name(name_id name) RTTR_NOEXCEPT
+{
+    auto& custom_name_to_id = detail::type_register_private::get_instance().get_custom_name_to_id();
+    auto ret = custom_name_to_id.find(name);
+    if (ret != custom_name_to_id.end())
+        return (*ret);
+
+    return detail::get_invalid_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 const detail::type_converter_base* type::get_type_converter(const type& target_type) const RTTR_NOEXCEPT
 {
     return detail::type_register_private::get_instance().get_converter(*this, target_type);
@@ -518,7 +585,7 @@ constructor type::get_constructor(const std::vector<type>& args) const RTTR_NOEX
     auto& ctors = m_type_data->m_class_data.m_ctors;
     for (const auto& ctor : ctors)
     {
-        if (detail::compare_with_type_list::compare(ctor.get_parameter_infos(), args))
+        if (ctor.m_wrapper->get_parameter_signature().matches(args))
             return ctor;
     }
 
@@ -527,6 +594,17 @@ constructor type::get_constructor(const std::vector<type>& args) const RTTR_NOEX
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+factory type::get_factory(const std::vector<type>& params) const RTTR_NOEXCEPT
+{
+    const auto ctor = get_constructor(params);
+    if (ctor)
+        return factory(ctor.m_wrapper);
+
+    return factory();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 array_range<constructor> type::get_constructors() const RTTR_NOEXCEPT
 {
     auto& ctors = m_type_data->m_class_data.m_ctors;
@@ -30,6 +30,7 @@
 
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/string_view.h"
+#include "rttr/name_id.h"
 #include "rttr/array_range.h"
 #include "rttr/filter_item.h"
 
@@ -44,6 +45,7 @@ namespace rttr
 
 class variant;
 class constructor;
+class factory;
 class destructor;
 class method;
 class property;
@@ -344,6 +346,16 @@ class RTTR_API type
          */
         static type get_by_name(string_view name) RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns the type object with the given name handle \p name.
+         *
+         * \remark In contrast to \ref type::get_by_name(string_view), the name will not be hashed again,
+         *         nor will strings be compared. Use this overload when the same name is looked up repeatedly.
+         *
+         * \return \ref type object with the name \p name.
+         */
+        static type get_by_name(name_id name) RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns a range of all registered type objects.
          *
@@ -360,6 +372,15 @@ class RTTR_API type
          */
         RTTR_INLINE std::size_t get_sizeof() const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns the alignment requirement in bytes of the current type (i.e. `alignof(T)`).
+         *
+         * \remark For `void` and function types, zero is returned.
+         *
+         * \return The alignment of the type in bytes.
+         */
+        RTTR_INLINE std::size_t get_alignof() const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns true whether the given type is class; that is not an atomic type or a method.
          *
@@ -621,6 +642,18 @@ class RTTR_API type
          */
         constructor get_constructor(const std::vector<type>& params = std::vector<type>() ) const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns a \ref factory for the public constructor whose parameters match the types in the specified list.
+         *
+         * The constructor is searched only once. Store the returned handle and reuse it,
+         * when many objects of this type have to be created.
+         *
+         * \remark When no parameter list is given, it will be searched for the default constructor.
+         *
+         * \return A valid factory, when a matching constructor was found; otherwise an invalid factory.
+         */
+        factory get_factory(const std::vector<type>& params = std::vector<type>() ) const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns a range of all registered *public* constructors for this type.
          *
@@ -724,6 +757,15 @@ class RTTR_API type
          */
         property get_property(string_view name) const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns a property with the name handle \p name.
+         *
+         * \remark When there exists no property with the name \p name, then an invalid property is returned.
+         *
+         * \return A property with name \p name.
+         */
+        property get_property(name_id name) const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns a range of all registered *public* properties for this type and
          *        all its base classes.
@@ -800,6 +842,15 @@ class RTTR_API type
          */
         static property get_global_property(string_view name) RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns a global property with the name handle \p name.
+         *
+         * \remark When there exists no property with the name \p name, then an invalid property is returned.
+         *
+         * \return A property with name \p name.
+         */
+        static property get_global_property(name_id name) RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns a range of all registered global properties.
          *
@@ -854,6 +905,15 @@ class RTTR_API type
          */
         method get_method(string_view name) const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns a method with the name handle \p name.
+         *
+         * \remark When there exists no method with the name \p name, then an invalid method is returned.
+         *
+         * \return A method with name \p name.
+         */
+        method get_method(name_id name) const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns a method with the name \p name which match the given parameter type list \p type_list.
          *
@@ -864,6 +924,16 @@ class RTTR_API type
          */
         method get_method(string_view name, const std::vector<type>& type_list) const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns a method with the name handle \p name which match the given parameter type list \p type_list.
+         *
+         * \remark When there exists no method with the name \p name and matching parameter type list \p type_list,
+         *         then an invalid method is returned.
+         *
+         * \return A method with name \p name.
+         */
+        method get_method(name_id name, const std::vector<type>& type_list) const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns a range of all registered *public* methods for this type and
          *        all its base classes.
@@ -940,6 +1010,15 @@ class RTTR_API type
          */
         static method get_global_method(string_view name) RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns a global method with the name handle \p name.
+         *
+         * \remark When there exists no method with the name \p name, and invalid method is returned.
+         *
+         * \return A method with name \p name.
+         */
+        static method get_global_method(name_id name) RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns a global method with the name \p name which match the given parameter list \p params.
          *
@@ -950,6 +1029,16 @@ class RTTR_API type
          */
         static method get_global_method(string_view name, const std::vector<type>& params) RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns a global method with the name handle \p name which match the given parameter list \p params.
+         *
+         * \remark When there exists no method with the name \p name and matching parameter list \p params,
+         *         then an invalid method is returned.
+         *
+         * \return A method with name \p name and parameter signature \p params.
+         */
+        static method get_global_method(name_id name, const std::vector<type>& params) RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns a range of all registered global methods.
          *
@@ -984,6 +1073,17 @@ class RTTR_API type
          */
         static variant invoke(string_view name, std::vector<argument> args);
 
+        /*!
+         * \brief Invokes a global method with the interned name \p name with the specified argument \p args.
+         *
+         * \remark Use this overload when the same global method is invoked repeatedly, e.g. from a script interpreter.
+         *
+         * \return A variant object containing the possible return value,
+         *         otherwise when it is a void function an empty but valid variant object.
+         *         Methods with registered \ref default_arguments will be honored.
+         */
+        static variant invoke(name_id name, std::vector<argument> args);
+
         /*!
          * \brief Register a converter func `F`, which will be used internally by the
          *        \ref variant class to convert between types.
@@ -1226,6 +1326,7 @@ class RTTR_API type
         friend class detail::type_register;
         friend class detail::type_register_private;
         friend class visitor;
+        friend class factory;
         friend struct detail::class_data;
 
         friend type detail::create_type(detail::type_data*) RTTR_NOEXCEPT;
@@ -0,0 +1,167 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <catch2/catch_all.hpp>
+
+using namespace rttr;
+
+struct factory_test_base
+{
+    virtual ~factory_test_base() {}
+    int base_value = 23;
+    RTTR_ENABLE()
+};
+
+struct factory_test_other_base
+{
+    virtual ~factory_test_other_base() {}
+    double other_value = 42.0;
+    RTTR_ENABLE()
+};
+
+struct factory_test_derived : factory_test_other_base, factory_test_base
+{
+    factory_test_derived() {}
+    factory_test_derived(int value) : value_1(value) {}
+    factory_test_derived(int value, std::string text) : value_1(value), text_1(std::move(text)) {}
+
+    int value_1 = 0;
+    std::string text_1;
+
+    RTTR_ENABLE(factory_test_other_base, factory_test_base)
+};
+
+struct factory_test_func
+{
+    static factory_test_func create(int value) { factory_test_func obj; obj.value = value; return obj; }
+    int value = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<factory_test_base>("factory_test_base");
+    registration::class_<factory_test_other_base>("factory_test_other_base");
+
+    registration::class_<factory_test_derived>("factory_test_derived")
+        .constructor<>()
+        .constructor<int>() (policy::ctor::as_raw_ptr)
+        .constructor<int, std::string>() (policy::ctor::as_std_shared_ptr);
+
+    registration::class_<factory_test_func>("factory_test_func")
+        .constructor(&factory_test_func::create);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("factory - retrieve", "[factory]")
+{
+    type t = type::get<factory_test_derived>();
+
+    factory f1 = t.get_factory({type::get<int>()});
+    CHECK(f1.is_valid() == true);
+    CHECK(static_cast<bool>(f1) == true);
+    CHECK(f1.get_declaring_type() == t);
+    CHECK(f1.get_constructor() == t.get_constructor({type::get<int>()}));
+
+    CHECK(t.get_factory() == t.get_factory());
+    CHECK(t.get_factory() != f1);
+
+    factory invalid = t.get_factory({type::get<double>()});
+    CHECK(invalid.is_valid() == false);
+    CHECK(invalid.get_constructor().is_valid() == false);
+    CHECK(invalid.get_declaring_type().is_valid() == false);
+    CHECK(invalid.create().is_valid() == false);
+    CHECK(invalid.create_shared<factory_test_derived>() == nullptr);
+
+    CHECK(factory().is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("factory - create()", "[factory]")
+{
+    type t = type::get<factory_test_derived>();
+
+    factory f = t.get_factory({type::get<int>()});
+    variant var = f.create({42});
+    REQUIRE(var.is_type<factory_test_derived*>() == true);
+    auto obj = var.get_value<factory_test_derived*>();
+    CHECK(obj->value_1 == 42);
+    CHECK(t.destroy(var) == true);
+
+    // wrong argument types
+    CHECK(f.create({std::string("text")}).is_valid() == false);
+    CHECK(f.create({}).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("factory - create_shared()", "[factory]")
+{
+    type t = type::get<factory_test_derived>();
+
+    SECTION("same type")
+    {
+        factory f = t.get_factory({type::get<int>(), type::get<std::string>()});
+        auto obj = f.create_shared<factory_test_derived>({5, std::string("text")});
+        REQUIRE(obj != nullptr);
+        CHECK(obj->value_1 == 5);
+        CHECK(obj->text_1 == "text");
+    }
+
+    SECTION("base type with offset")
+    {
+        factory f = t.get_factory({type::get<int>()});
+        auto obj = f.create_shared<factory_test_base>({7});
+        REQUIRE(obj != nullptr);
+        CHECK(obj->base_value == 23);
+        CHECK(type::get(*obj) == t);
+        CHECK(static_cast<factory_test_derived*>(obj.get())->value_1 == 7);
+    }
+
+    SECTION("invalid target type")
+    {
+        factory f = t.get_factory();
+        CHECK(f.create_shared({}, type::get<factory_test_func>()) == nullptr);
+    }
+
+    SECTION("custom creator function")
+    {
+        factory f = type::get<factory_test_func>().get_factory({type::get<int>()});
+        REQUIRE(f.is_valid() == true);
+        CHECK(f.create_shared<factory_test_func>({1}) == nullptr);
+
+        variant var = f.create({1});
+        REQUIRE(var.is_type<factory_test_func>() == true);
+        CHECK(var.get_value<factory_test_func>().value == 1);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,139 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <catch2/catch_all.hpp>
+
+#include <string>
+
+using namespace rttr;
+
+static int g_invoke_at_dtor_count = 0;
+
+struct alignas(16) ctor_invoke_at_test
+{
+    ctor_invoke_at_test() {}
+    ctor_invoke_at_test(int value) : value_1(value) {}
+    ctor_invoke_at_test(int value, const std::string& text) : value_1(value), text_1(text) {}
+    ctor_invoke_at_test(int p1, int p2, int p3, int p4, int p5, int p6, int p7)
+    :   value_1(p1 + p2 + p3 + p4 + p5 + p6 + p7)
+    {}
+    ~ctor_invoke_at_test() { ++g_invoke_at_dtor_count; }
+
+    static ctor_invoke_at_test create(double) { return ctor_invoke_at_test(); }
+
+    int value_1 = 12;
+    std::string text_1 = "default";
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<ctor_invoke_at_test>("ctor_invoke_at_test")
+        .constructor<>()
+        .constructor<int>()
+        .constructor<int, const std::string&>() (policy::ctor::as_std_shared_ptr)
+        .constructor<int, int, int, int, int, int, int>()
+        .constructor(&ctor_invoke_at_test::create);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("constructor - invoke_at", "[constructor]")
+{
+    type t = type::get<ctor_invoke_at_test>();
+    REQUIRE(t.get_sizeof() == sizeof(ctor_invoke_at_test));
+    REQUIRE(t.get_alignof() == alignof(ctor_invoke_at_test));
+
+    alignas(ctor_invoke_at_test) unsigned char storage[sizeof(ctor_invoke_at_test)];
+    auto obj = reinterpret_cast<ctor_invoke_at_test*>(storage);
+
+    destructor dtor = t.get_destructor();
+    REQUIRE(dtor.is_valid() == true);
+
+    SECTION("default ctor")
+    {
+        g_invoke_at_dtor_count = 0;
+        constructor ctor = t.get_constructor();
+        REQUIRE(ctor.invoke_at(storage) == true);
+        CHECK(obj->value_1 == 12);
+        CHECK(obj->text_1 == "default");
+
+        CHECK(dtor.invoke_at(storage) == true);
+        CHECK(g_invoke_at_dtor_count == 1);
+    }
+
+    SECTION("with arguments")
+    {
+        constructor ctor = t.get_constructor({type::get<int>(), type::get<std::string>()});
+        std::string text = "text";
+        REQUIRE(ctor.invoke_at(storage, 23, text) == true);
+        CHECK(obj->value_1 == 23);
+        CHECK(obj->text_1 == "text");
+        CHECK(dtor.invoke_at(storage) == true);
+    }
+
+    SECTION("variadic")
+    {
+        constructor ctor = t.get_constructor({type::get<int>(), type::get<int>(), type::get<int>(), type::get<int>(),
+                                              type::get<int>(), type::get<int>(), type::get<int>()});
+        REQUIRE(ctor.invoke_at_variadic(storage, {1, 2, 3, 4, 5, 6, 7}) == true);
+        CHECK(obj->value_1 == 28);
+        CHECK(dtor.invoke_at(storage) == true);
+    }
+
+    SECTION("invalid")
+    {
+        g_invoke_at_dtor_count = 0;
+        constructor ctor = t.get_constructor({type::get<int>()});
+        CHECK(ctor.invoke_at(storage, std::string("wrong type")) == false);
+        CHECK(ctor.invoke_at(storage) == false);
+        CHECK(ctor.invoke_at(nullptr, 23) == false);
+        CHECK(ctor.invoke_at(storage + 1, 23) == false);
+
+        constructor func_ctor = t.get_constructor({type::get<double>()});
+        REQUIRE(func_ctor.is_valid() == true);
+        CHECK(func_ctor.invoke_at(storage, 1.0) == false);
+
+        CHECK(constructor(type::get<int>().get_constructor()).invoke_at(storage) == false);
+        CHECK(dtor.invoke_at(nullptr) == false);
+        CHECK(g_invoke_at_dtor_count == 0);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type - get_alignof", "[type]")
+{
+    CHECK(type::get<char>().get_alignof() == alignof(char));
+    CHECK(type::get<double>().get_alignof() == alignof(double));
+    CHECK(type::get<void>().get_alignof() == 0);
+    CHECK(type::get_by_name("").get_alignof() == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -130,6 +130,26 @@ struct derived_class_without_registered_props : base_class_with_props
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+struct base_class_with_late_props
+{
+    base_class_with_late_props() : base_value(1) {}
+    int base_value;
+
+    virtual ~base_class_with_late_props() = default;
+    RTTR_ENABLE()
+};
+
+struct derived_class_with_late_base_props : base_class_with_late_props
+{
+    derived_class_with_late_base_props() : derived_value(2) {}
+    int derived_value;
+
+    virtual ~derived_class_with_late_base_props() override = default;
+    RTTR_ENABLE(base_class_with_late_props)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 static double g_name;
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -590,3 +610,27 @@ TEST_CASE("property - check inheritance of probs", "[property]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - base class properties registered after derived class", "[property]")
+{
+    registration::class_<derived_class_with_late_base_props>("derived_class_with_late_base_props")
+        .property("derived_value", &derived_class_with_late_base_props::derived_value);
+
+    type t_prop = type::get<derived_class_with_late_base_props>();
+    REQUIRE(t_prop.get_properties().size() == 1);
+    CHECK(t_prop.get_property("base_value").is_valid() == false);
+
+    registration::class_<base_class_with_late_props>("base_class_with_late_props")
+        .property("base_value", &base_class_with_late_props::base_value);
+
+    auto prop_range = t_prop.get_properties();
+    REQUIRE(prop_range.size() == 2);
+    // base class properties are listed first
+    CHECK((*prop_range.begin()).get_name() == "base_value");
+    CHECK((*prop_range.rbegin()).get_name() == "derived_value");
+
+    derived_class_with_late_base_props obj;
+    CHECK(t_prop.get_property_value("base_value", obj).to_int() == 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
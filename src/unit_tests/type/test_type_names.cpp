@@ -29,6 +29,10 @@
 
 #include <catch2/catch_all.hpp>
 #include <rttr/type>
+#include <rttr/registration>
+
+#include <memory>
+#include <vector>
 
 using namespace rttr;
 
@@ -59,4 +63,34 @@ TEST_CASE("Test rttr::type - type::get_by_name", "[type]")
 TEST_CASE("Test rttr::type - type::get_name", "[type]")
 {
    CHECK(type::get<std::milli>().get_name() == "std::milli");
-}
\ No newline at end of file
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct custom_name_propagation_test {};
+
+TEST_CASE("Test rttr::type - custom name propagates to derived names", "[type]")
+{
+    // register the derived types first, the custom name has to be propagated afterwards
+    const auto ptr_type         = type::get<custom_name_propagation_test*>();
+    const auto const_ptr_type   = type::get<const custom_name_propagation_test**>();
+    const auto array_type       = type::get<custom_name_propagation_test[4]>();
+    const auto shared_ptr_type  = type::get<std::shared_ptr<custom_name_propagation_test>>();
+    const auto ptr_to_template  = type::get<std::shared_ptr<custom_name_propagation_test>*>();
+
+    registration::class_<custom_name_propagation_test>("renamed_type");
+
+    CHECK(type::get<custom_name_propagation_test>().get_name() == "renamed_type");
+    CHECK(ptr_type.get_name() == "renamed_type*");
+    CHECK(const_ptr_type.get_name() == "const renamed_type**");
+    CHECK(array_type.get_name() == "renamed_type[4]");
+    CHECK(shared_ptr_type.get_name().to_string().find("<renamed_type>") != std::string::npos);
+    // transitive: the name of the template instance has changed, so its pointer type follows
+    CHECK(ptr_to_template.get_name() == shared_ptr_type.get_name().to_string() + "*");
+
+    CHECK(type::get_by_name("renamed_type*") == ptr_type);
+    CHECK(type::get_by_name("renamed_type[4]") == array_type);
+    CHECK(type::get_by_name(shared_ptr_type.get_name()) == shared_ptr_type);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
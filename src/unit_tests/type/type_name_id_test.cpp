@@ -0,0 +1,187 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <catch2/catch_all.hpp>
+
+using namespace rttr;
+
+struct name_id_test_base
+{
+    int p1 = 12;
+    int get_value() const { return p1; }
+
+    virtual ~name_id_test_base() = default;
+    RTTR_ENABLE()
+};
+
+struct name_id_test_derived : name_id_test_base
+{
+    int p2 = 23;
+    int add(int value) const { return p2 + value; }
+    int add(int a, int b) const { return a + b; }
+
+    virtual ~name_id_test_derived() override = default;
+    RTTR_ENABLE(name_id_test_base)
+};
+
+static int g_name_id_prop = 42;
+static int name_id_global_func(int value) { return value * 2; }
+static int name_id_global_func(int a, int b) { return a * b; }
+
+RTTR_REGISTRATION
+{
+    registration::class_<name_id_test_base>("name_id_test_base")
+        .property("p1", &name_id_test_base::p1)
+        .method("get_value", &name_id_test_base::get_value);
+
+    registration::class_<name_id_test_derived>("name_id_test_derived")
+        .property("p2", &name_id_test_derived::p2)
+        .method("add", select_overload<int(int) const>(&name_id_test_derived::add))
+        .method("add", select_overload<int(int, int) const>(&name_id_test_derived::add));
+
+    registration::property("g_name_id_prop", &g_name_id_prop);
+    registration::method("name_id_global_func", select_overload<int(int)>(&name_id_global_func));
+    registration::method("name_id_global_func", select_overload<int(int, int)>(&name_id_global_func));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("name_id - basics", "[name_id]")
+{
+    name_id invalid;
+    CHECK(invalid.is_valid() == false);
+    CHECK(static_cast<bool>(invalid) == false);
+    CHECK(invalid.get_name().empty() == true);
+    CHECK(name_id(string_view()) == invalid);
+
+    name_id a("some_name");
+    const std::string text = "some_name";
+    name_id b(text);
+    name_id c("other_name");
+
+    CHECK(a.is_valid() == true);
+    CHECK(a == b);
+    CHECK(a != c);
+    CHECK(a.get_name().data() == b.get_name().data());
+    CHECK(a.get_name() == "some_name");
+    CHECK(a == string_view("some_name"));
+    CHECK(string_view("other_name") == c);
+    CHECK(a != string_view("other_name"));
+
+    CHECK(a.get_hash() == std::hash<string_view>()(string_view("some_name")));
+    CHECK(std::hash<name_id>()(a) == a.get_hash());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("name_id - type::get_by_name", "[name_id]")
+{
+    CHECK(type::get_by_name(name_id("name_id_test_derived")) == type::get<name_id_test_derived>());
+    CHECK(type::get_by_name(name_id("name_id_test_derived*")) == type::get<name_id_test_derived*>());
+    CHECK(type::get_by_name(name_id("int")) == type::get<int>());
+    CHECK(type::get_by_name(name_id("name_id_not_registered")).is_valid() == false);
+    CHECK(type::get_by_name(name_id()).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("name_id - member lookup", "[name_id]")
+{
+    const auto t = type::get<name_id_test_derived>();
+
+    SECTION("property")
+    {
+        const auto p1 = t.get_property(name_id("p1"));
+        REQUIRE(p1.is_valid() == true);
+        CHECK(p1 == t.get_property("p1"));
+        CHECK(p1.get_name_id() == name_id("p1"));
+        CHECK(t.get_property(name_id("p2")) == t.get_property("p2"));
+        CHECK(t.get_property(name_id("p3")).is_valid() == false);
+    }
+
+    SECTION("method")
+    {
+        const auto meth = t.get_method(name_id("get_value"));
+        REQUIRE(meth.is_valid() == true);
+        CHECK(meth.get_name_id().get_name() == "get_value");
+
+        name_id_test_derived obj;
+        CHECK(meth.invoke(obj).get_value<int>() == 12);
+
+        const auto add_1 = t.get_method(name_id("add"), {type::get<int>()});
+        const auto add_2 = t.get_method(name_id("add"), {type::get<int>(), type::get<int>()});
+        REQUIRE(add_1.is_valid() == true);
+        REQUIRE(add_2.is_valid() == true);
+        CHECK(add_1 == t.get_method("add", {type::get<int>()}));
+        CHECK(add_1.invoke(obj, 2).get_value<int>() == 25);
+        CHECK(add_2.invoke(obj, 2, 3).get_value<int>() == 5);
+
+        CHECK(t.get_method(name_id("add"), {type::get<bool>()}).is_valid() == false);
+        CHECK(t.get_method(name_id("remove")).is_valid() == false);
+    }
+
+    SECTION("global property")
+    {
+        const auto prop = type::get_global_property(name_id("g_name_id_prop"));
+        REQUIRE(prop.is_valid() == true);
+        CHECK(prop == type::get_global_property("g_name_id_prop"));
+
+        variant var = prop.get_value(instance());
+        REQUIRE(var.is_type<int*>() == true);
+        CHECK(*var.get_value<int*>() == 42);
+
+        CHECK(type::get_global_property(name_id("g_name_id_unknown")).is_valid() == false);
+    }
+
+    SECTION("global method")
+    {
+        const auto meth = type::get_global_method(name_id("name_id_global_func"));
+        REQUIRE(meth.is_valid() == true);
+        CHECK(meth == type::get_global_method("name_id_global_func"));
+
+        const auto meth_2 = type::get_global_method(name_id("name_id_global_func"), {type::get<int>(), type::get<int>()});
+        REQUIRE(meth_2.is_valid() == true);
+        CHECK(meth_2.invoke(instance(), 3, 4).get_value<int>() == 12);
+        CHECK(type::get_global_method(name_id("name_id_global_func"), {type::get<bool>()}).is_valid() == false);
+    }
+
+    SECTION("global invoke")
+    {
+        const name_id func_id("name_id_global_func");
+        CHECK(type::invoke(func_id, {5}).get_value<int>() == 10);
+        CHECK(type::invoke(func_id, {3, 4}).get_value<int>() == 12);
+        CHECK(type::invoke("name_id_global_func", {3, 4}).get_value<int>() == 12);
+
+        CHECK(type::invoke(func_id, {}).is_valid() == false);
+        CHECK(type::invoke(func_id, {true}).is_valid() == false);
+        CHECK(type::invoke(name_id("name_id_unknown_func"), {5}).is_valid() == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
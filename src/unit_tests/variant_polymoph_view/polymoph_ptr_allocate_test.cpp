@@ -0,0 +1,150 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch2/catch_all.hpp>
+
+#include <rttr/type>
+#include <rttr/registration>
+
+#include <memory_resource>
+
+using namespace rttr;
+
+static int g_alloc_node_dtor_count = 0;
+
+struct alloc_node
+{
+    alloc_node() {}
+    alloc_node(int value) : value(value) {}
+    virtual ~alloc_node() { ++g_alloc_node_dtor_count; }
+
+    int value = 0;
+
+    RTTR_ENABLE()
+};
+
+struct alloc_mixin
+{
+    virtual ~alloc_mixin() {}
+    double weight = 1.0;
+
+    RTTR_ENABLE()
+};
+
+struct alloc_sub_node : alloc_mixin, alloc_node
+{
+    alloc_sub_node() {}
+    alloc_sub_node(int value) : alloc_node(value) {}
+
+    std::string name = "sub";
+
+    RTTR_ENABLE(alloc_mixin, alloc_node)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<alloc_node>("alloc_node")
+        .constructor<int>();
+
+    registration::class_<alloc_mixin>("alloc_mixin");
+
+    registration::class_<alloc_sub_node>("alloc_sub_node")
+        .constructor<int>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool is_inside(const void* ptr, const unsigned char* buffer, std::size_t size)
+{
+    auto p = static_cast<const unsigned char*>(ptr);
+    return (p >= buffer && p < buffer + size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("polymoph_ptr - allocate from memory resource", "[polymoph_ptr]")
+{
+    unsigned char buffer[4096];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    SECTION("compile time type")
+    {
+        g_alloc_node_dtor_count = 0;
+        {
+            auto ptr = polymoph_ptr<alloc_node>::allocate<alloc_sub_node>(std::pmr::polymorphic_allocator<alloc_sub_node>(&arena), 42);
+            REQUIRE(ptr.is_valid() == true);
+            CHECK(ptr.get_real_type() == type::get<alloc_sub_node>());
+            CHECK(ptr->value == 42);
+            CHECK(static_cast<alloc_sub_node*>(ptr.get())->name == "sub");
+            CHECK(is_inside(ptr.get(), buffer, sizeof(buffer)) == true);
+
+            variant var = ptr.get_variant();
+            CHECK(var.get_type() == type::get<alloc_sub_node*>());
+        }
+        CHECK(g_alloc_node_dtor_count == 1);
+    }
+
+    SECTION("runtime type")
+    {
+        g_alloc_node_dtor_count = 0;
+        factory sub_factory = type::get_by_name("alloc_sub_node").get_factory({type::get<int>()});
+        REQUIRE(sub_factory.is_valid() == true);
+        {
+            auto first = polymoph_ptr<alloc_node>::make(&arena, sub_factory, {1});
+            auto second = polymoph_ptr<alloc_node>::make(&arena, sub_factory, {2});
+            REQUIRE(first.is_valid() == true);
+            REQUIRE(second.is_valid() == true);
+
+            CHECK(first.get_real_type() == type::get<alloc_sub_node>());
+            CHECK(first->value == 1);
+            CHECK(second->value == 2);
+            CHECK(static_cast<alloc_sub_node*>(second.get())->name == "sub");
+
+            // object and control block are inside the arena
+            CHECK(is_inside(first.get(), buffer, sizeof(buffer)) == true);
+            CHECK(is_inside(second.get(), buffer, sizeof(buffer)) == true);
+
+            auto copy = first;
+            CHECK(copy == first);
+        }
+        CHECK(g_alloc_node_dtor_count == 2);
+    }
+
+    SECTION("invalid")
+    {
+        factory sub_factory = type::get_by_name("alloc_sub_node").get_factory({type::get<int>()});
+        CHECK(polymoph_ptr<alloc_node>::make(&arena, sub_factory, {std::string("wrong")}).is_valid() == false);
+        CHECK(polymoph_ptr<alloc_node>::make(nullptr, sub_factory, {1}).is_valid() == false);
+        CHECK(polymoph_ptr<alloc_node>::make(&arena, factory(), {1}).is_valid() == false);
+        CHECK(sub_factory.allocate_shared<alloc_node>(&arena, {1}) != nullptr);
+        CHECK(sub_factory.allocate_shared(&arena, {1}, type::get<int>()) == nullptr);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////